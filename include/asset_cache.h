@@ -0,0 +1,36 @@
+#ifndef ASSET_CACHE_H
+#define ASSET_CACHE_H
+
+#include <raylib.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// --- CACHE GLOBAL DE TEXTURAS E SONS ---
+// Chaveado pelo caminho do arquivo e com contagem de referências: cada Load soma uma
+// referência e cada Unload tira uma. Sem referências o asset continua residente e só sai
+// (do menos usado recentemente para o mais) quando o total passa do orçamento.
+// Voltar para uma cena já visitada vira um acerto de cache, sem disco nem decodificação.
+// Só pode ser usado na thread principal (contexto OpenGL/áudio).
+#define ASSET_CACHE_TEXTURE_BUDGET (256u * 1024u * 1024u) // VRAM estimada
+#define ASSET_CACHE_SOUND_BUDGET   (32u * 1024u * 1024u)  // PCM decodificado
+
+typedef struct {
+    int hits;
+    int misses;
+    int evictions;
+    int textureCount;       // Texturas residentes (em uso ou não)
+    int soundCount;
+    size_t textureBytes;
+    size_t soundBytes;
+} AssetCacheStats;
+
+Texture2D AssetCache_LoadTexture(const char *path);
+void AssetCache_UnloadTexture(Texture2D texture);
+Sound AssetCache_LoadSound(const char *path);
+void AssetCache_UnloadSound(Sound sound);
+
+void AssetCache_SetBudgets(size_t textureBytes, size_t soundBytes);
+AssetCacheStats AssetCache_GetStats(void);
+void AssetCache_Shutdown(void);     // Libera tudo (antes de fechar a janela/áudio)
+
+#endif
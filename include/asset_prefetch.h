@@ -0,0 +1,36 @@
+#ifndef ASSET_PREFETCH_H
+#define ASSET_PREFETCH_H
+
+#include <raylib.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// --- PRÉ-CARREGAMENTO DE ASSETS ---
+// Uma thread lê e decodifica as imagens (CPU) enquanto a intro e o menu rodam.
+// Na hora do Init, a tela só precisa enviar a Image pronta para a GPU (via asset_cache).
+// Os grupos são carregados nesta ordem (prioridade).
+typedef enum {
+    PREFETCH_MENU = 0,
+    PREFETCH_LOBBY,
+    PREFETCH_MINIGAMES,
+    PREFETCH_GROUP_COUNT
+} PrefetchGroup;
+
+typedef struct {
+    int itemsDone;      // Itens processados (carregados ou que falharam)
+    int itemsTotal;
+    size_t bytesDone;   // Bytes de arquivo já lidos
+    size_t bytesTotal;  // Conhecido assim que a thread mede os arquivos do grupo
+} PrefetchProgress;
+
+void AssetPrefetch_Start(void);
+void AssetPrefetch_Shutdown(void);      // Espera a thread e libera as imagens não usadas
+
+// Retira a imagem pré-carregada (o chamador passa a ser o dono). Se ainda estiver sendo
+// carregada, espera; se nem começou, cancela e retorna false para o chamador ler do disco.
+bool AssetPrefetch_TakeImage(const char *path, Image *image);
+
+PrefetchProgress AssetPrefetch_GetProgress(PrefetchGroup group);
+bool AssetPrefetch_IsGroupDone(PrefetchGroup group);
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef ATOMIC_OPS_H
+#define ATOMIC_OPS_H
+
+// Acesso atômico via builtins do GCC/MinGW (o projeto compila em C99, sem <stdatomic.h>)
+#define ATOMIC_LOAD(p)          __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define ATOMIC_STORE(p, v)      __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define ATOMIC_EXCHANGE(p, v)   __atomic_exchange_n((p), (v), __ATOMIC_ACQ_REL)
+#define ATOMIC_CAS(p, e, d)     __atomic_compare_exchange_n((p), (e), (d), false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#define ATOMIC_ADD(p, v)        __atomic_add_fetch((p), (v), __ATOMIC_ACQ_REL)
+#define ATOMIC_SUB(p, v)        __atomic_sub_fetch((p), (v), __ATOMIC_ACQ_REL)
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef JPEG_YUV_H
+#define JPEG_YUV_H
+
+#include <stdbool.h>
+
+// --- DECODIFICADOR JPEG PLANAR ---
+// Decodifica JPEG baseline (Huffman, 8 bits, 3 componentes) parando antes da conversão
+// de cor: devolve os planos Y, Cb e Cr separados, na resolução original de cada um
+// (ex: 4:2:0 -> Cb/Cr com metade da largura e da altura). A conversão para RGB e o
+// upsampling do croma ficam para a GPU. Qualquer outro tipo de JPEG é recusado.
+
+typedef struct {
+    unsigned char *data;        // Y, Cb e Cr em sequência (um único bloco, liberar com JpegYuv_Unload)
+    unsigned char *planes[3];   // Início de cada plano dentro de 'data'
+    int planeWidth[3];          // Dimensões de cada plano (alinhadas ao MCU)
+    int planeHeight[3];
+    int width;                  // Tamanho real da imagem (<= plano Y)
+    int height;
+} YuvImage;
+
+// Só lê os cabeçalhos: true se o JPEG pode ser decodificado em planos
+bool JpegYuv_IsSupported(const unsigned char *data, int size);
+bool JpegYuv_Decode(const unsigned char *data, int size, YuvImage *out);
+void JpegYuv_Unload(YuvImage *image);
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Arquivo mapeado em memória (somente leitura).
+// Os bytes são lidos direto do cache de páginas do sistema, sem cópia.
+typedef struct {
+    const unsigned char *data;
+    size_t size;
+    void *handle;   // Handles do sistema (Windows: mapeamento; POSIX: não usado)
+} MappedFile;
+
+// Mapeia o arquivo inteiro. Retorna false se não existir ou estiver vazio.
+bool MappedFile_Open(MappedFile *file, const char *path);
+void MappedFile_Close(MappedFile *file);
+
+#endif // MAPPED_FILE_H
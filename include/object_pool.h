@@ -0,0 +1,109 @@
+#ifndef OBJECT_POOL_H
+#define OBJECT_POOL_H
+
+#include <stdbool.h>
+
+// --- POOL DE OBJETOS (GERADO POR MACRO) ---
+// Pool de capacidade fixa com ids estáveis: um objeto fica no mesmo slot (id) do acquire ao
+// release, então grid, interpolação e quem mais guardar o id continuam valendo. Por dentro:
+//   dense[0, count)          ids vivos, compactos: o laço de update/desenho só passa por eles
+//   dense[count, Capacity)   ids livres (a free list)
+//   slot[id]                 posição do id em dense
+// Acquire pega o primeiro livre e Release troca o id com o último vivo (swap-remove): os
+// dois são O(1), sem procurar slot livre nem pular buracos. A ordem dos vivos em dense muda
+// a cada release; ela é determinística, mas não é a ordem dos ids.
+// Cheio, o acquire é recusado (o objeto novo não nasce, nenhum vivo é sobrescrito) e conta
+// em overflow, para o chamador saber que a capacidade ficou curta.
+//
+// Soltar durante a iteração: o último vivo vem para a posição atual, então não avance:
+//   for (int k = 0; k < pool.count; ) {
+//       int id = pool.dense[k];
+//       if (morreu) Pool_Release(&pool, id); else k++;
+//   }
+//
+// DECLARE_ID_POOL(Nome, Capacidade): só os ids; os dados ficam com o dono, em arrays
+// indexados pelo id (serve para estrutura de arrays). Gera o tipo Nome e as funções
+// Nome_Clear, Nome_Acquire, Nome_AcquireId, Nome_Release e Nome_IsLive.
+// DECLARE_OBJECT_POOL(Nome, Tipo, Capacidade): ids mais um array items[Capacidade] de Tipo.
+// Gera Nome (com o pool de ids em Nome.ids) e Nome_Clear, Nome_Acquire (Tipo * ou NULL),
+// Nome_Release, Nome_Count e Nome_At (o k-ésimo vivo).
+
+#define DECLARE_ID_POOL(Name, Capacity)                                                     \
+    typedef struct {                                                                        \
+        int dense[Capacity];                                                                \
+        int slot[Capacity];                                                                 \
+        int count;                                                                          \
+        int overflow;   /* Acquires recusados (pool cheio) desde o último Clear */          \
+    } Name;                                                                                 \
+                                                                                            \
+    static inline void Name##_Clear(Name *pool) {                                           \
+        for (int i = 0; i < (Capacity); i++) {                                              \
+            pool->dense[i] = i;                                                             \
+            pool->slot[i] = i;                                                              \
+        }                                                                                   \
+        pool->count = 0;                                                                    \
+        pool->overflow = 0;                                                                 \
+    }                                                                                       \
+                                                                                            \
+    static inline bool Name##_IsLive(const Name *pool, int id) {                            \
+        return id >= 0 && id < (Capacity) && pool->slot[id] < pool->count;                 \
+    }                                                                                       \
+                                                                                            \
+    /* Traz o id (livre) para a fronteira e a avança */                                     \
+    static inline void Name##_Take(Name *pool, int id) {                                    \
+        int at = pool->slot[id];                                                            \
+        int other = pool->dense[pool->count];                                               \
+        pool->dense[at] = other;                                                            \
+        pool->slot[other] = at;                                                             \
+        pool->dense[pool->count] = id;                                                      \
+        pool->slot[id] = pool->count;                                                       \
+        pool->count++;                                                                      \
+    }                                                                                       \
+                                                                                            \
+    /* Um id livre qualquer, ou -1 se o pool estiver cheio */                               \
+    static inline int Name##_Acquire(Name *pool) {                                          \
+        if (pool->count >= (Capacity)) {                                                    \
+            pool->overflow++;                                                               \
+            return -1;                                                                      \
+        }                                                                                   \
+        int id = pool->dense[pool->count];                                                  \
+        pool->slot[id] = pool->count++;                                                     \
+        return id;                                                                          \
+    }                                                                                       \
+                                                                                            \
+    /* Um id escolhido (ex.: a posição na formação); false se já estiver vivo */            \
+    static inline bool Name##_AcquireId(Name *pool, int id) {                               \
+        if (id < 0 || id >= (Capacity) || Name##_IsLive(pool, id)) return false;            \
+        Name##_Take(pool, id);                                                              \
+        return true;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    static inline void Name##_Release(Name *pool, int id) {                                 \
+        if (!Name##_IsLive(pool, id)) return;                                               \
+        int at = pool->slot[id];                                                            \
+        int last = pool->dense[--pool->count];                                              \
+        pool->dense[at] = last;                                                             \
+        pool->slot[last] = at;                                                              \
+        pool->dense[pool->count] = id;                                                      \
+        pool->slot[id] = pool->count;                                                       \
+    }
+
+#define DECLARE_OBJECT_POOL(Name, Type, Capacity)                                           \
+    DECLARE_ID_POOL(Name##Ids, Capacity)                                                    \
+    typedef struct {                                                                        \
+        Type items[Capacity];   /* Indexado pelo id (slot estável) */                       \
+        Name##Ids ids;                                                                      \
+    } Name;                                                                                 \
+                                                                                            \
+    static inline void Name##_Clear(Name *pool) { Name##Ids_Clear(&pool->ids); }            \
+                                                                                            \
+    static inline Type *Name##_Acquire(Name *pool) {                                        \
+        int id = Name##Ids_Acquire(&pool->ids);                                             \
+        return (id >= 0) ? &pool->items[id] : (Type *)0;                                    \
+    }                                                                                       \
+                                                                                            \
+    static inline void Name##_Release(Name *pool, int id) { Name##Ids_Release(&pool->ids, id); } \
+    static inline int Name##_Count(const Name *pool) { return pool->ids.count; }            \
+    static inline Type *Name##_At(Name *pool, int k) { return &pool->items[pool->ids.dense[k]]; }
+
+#endif // OBJECT_POOL_H
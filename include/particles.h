@@ -0,0 +1,62 @@
+#ifndef PARTICLES_H
+#define PARTICLES_H
+
+#include <raylib.h>
+#include <stdbool.h>
+
+// --- SISTEMA DE PARTÍCULAS COMPARTILHADO ---
+// Usado pelo Guitar Hero e pelo Byte Space. Armazenamento em estrutura de arrays (um
+// array por campo) e sempre compacto: as vivas ocupam [0, count), e uma partícula que
+// morre é trocada pela última (sem buracos nem flag de ativa). Assim a integração é um
+// laço reto sobre arrays de float, que o compilador vetoriza (SSE/AVX), e o custo segue
+// o número de partículas vivas, não a capacidade.
+// Cheio, o sistema descarta as novas emissões (nenhuma viva é sobrescrita) e as conta em
+// dropped, para se ver quando a capacidade ficou curta.
+// No desenho cada partícula é um quad do mesmo sprite branco tingido pela sua cor, em
+// blend aditivo: o batch da raylib junta todas num único draw call.
+
+typedef enum {
+    PARTICLE_SHAPE_SQUARE,      // Quadrado de lado size (canto superior esquerdo na posição)
+    PARTICLE_SHAPE_CIRCLE       // Disco de borda suave, raio size (centro na posição)
+} ParticleShape;
+
+typedef struct {
+    float gravity;              // Aceleração em y (px/s²)
+    float drag;                 // Fração da velocidade perdida por segundo
+    bool bounded;               // Quica nas bordas de bounds
+    Rectangle bounds;
+    float fadeSeconds;          // Transparência = vida restante / fadeSeconds
+    ParticleShape shape;
+    float size;
+} ParticleConfig;
+
+typedef struct {
+    float *posX;
+    float *posY;
+    float *velX;
+    float *velY;
+    float *life;                // Segundos restantes
+    Color *color;
+    int count;                  // Vivas, sempre em [0, count)
+    int capacity;
+    int dropped;                // Emissões descartadas por falta de espaço desde o último Clear
+    ParticleConfig config;
+    Texture2D sprite;           // Forma da partícula em branco (só com janela aberta)
+} ParticleSystem;
+
+// Aloca os arrays (um bloco só) e, com a janela já aberta, gera o sprite da forma.
+// Cada Init pede um ParticleSystem_Unload
+bool ParticleSystem_Init(ParticleSystem *system, int capacity, ParticleConfig config);
+void ParticleSystem_Unload(ParticleSystem *system);
+void ParticleSystem_Clear(ParticleSystem *system);
+
+// Adiciona uma partícula; false (e dropped + 1) se o sistema estiver cheio
+bool ParticleSystem_Emit(ParticleSystem *system, Vector2 position, Vector2 velocity, Color color, float life);
+
+// Integra posição/velocidade (gravidade, arrasto, bordas) e remove as que morreram
+void ParticleSystem_Update(ParticleSystem *system, float dt);
+
+// Desenha todas as vivas em blend aditivo (sem sprite, ou seja, sem janela, não desenha nada)
+void ParticleSystem_Draw(const ParticleSystem *system);
+
+#endif
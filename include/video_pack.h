@@ -0,0 +1,51 @@
+#ifndef VIDEO_PACK_H
+#define VIDEO_PACK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "mapped_file.h"
+
+// --- FORMATO .vpk (Video Pack) ---
+// Um único arquivo com todos os frames de um vídeo:
+//   [VideoPackHeader][VideoPackEntry x frameCount][payloads comprimidos contíguos]
+// Todos os campos são little-endian. Gerado offline pela ferramenta tools/pack_video.c.
+#define VIDEO_PACK_MAGIC "ISVP"
+#define VIDEO_PACK_VERSION 1
+
+typedef enum {
+    VIDEO_CODEC_JPEG = 1    // Cada payload é um arquivo .jpg completo
+} VideoPackCodec;
+
+typedef struct {
+    char magic[4];          // "ISVP"
+    uint32_t version;
+    uint32_t frameCount;
+    uint32_t width;
+    uint32_t height;
+    float fps;
+    uint32_t codec;         // VideoPackCodec
+    uint32_t reserved;
+} VideoPackHeader;
+
+typedef struct {
+    uint64_t offset;        // Posição do payload a partir do início do arquivo
+    uint32_t size;          // Tamanho do payload em bytes
+    uint32_t reserved;
+} VideoPackEntry;
+
+// Pack aberto via mmap: header, índice e payloads apontam direto para o mapeamento
+typedef struct {
+    MappedFile file;
+    const VideoPackHeader *header;
+    const VideoPackEntry *index;
+} VideoPack;
+
+// Abre e valida o pack (magic, versão e limites de todas as entradas)
+bool VideoPack_Open(VideoPack *pack, const char *path);
+
+// Retorna o payload do frame sem cópia (NULL se o índice for inválido)
+const unsigned char *VideoPack_GetFrame(const VideoPack *pack, int frame, int *size);
+
+void VideoPack_Close(VideoPack *pack);
+
+#endif // VIDEO_PACK_H
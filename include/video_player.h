@@ -3,6 +3,34 @@
 
 #include <raylib.h>
 #include <stdbool.h>
+#include <stddef.h>
+
+// Anel fixo de texturas reutilizadas via UpdateTexture (alocado uma vez no Init)
+#define VIDEO_TEXTURE_RING 3
+
+// Limites de VideoPlayer_SetRate
+#define VIDEO_RATE_MIN 0.25f
+#define VIDEO_RATE_MAX 4.0f
+
+// Estatísticas de reprodução (úteis para medir stuttering)
+typedef struct {
+    int decodedFrames;  // Frames decodificados pelos workers
+    int uploadedFrames; // Frames enviados para a GPU
+    size_t uploadedBytes; // Bytes enviados para a GPU (mede a banda de upload)
+    int lateFrames;     // Frames que não estavam prontos no momento de serem exibidos
+    int droppedFrames;  // Frames pulados sem nunca aparecer na tela
+    int skippedDecodes; // Frames pulados antes mesmo de serem decodificados
+    int repeatedFrames; // Trocas de frame em que a imagem anterior continuou na tela
+    float drift;        // Tempo do frame exibido - tempo do áudio (segundos)
+    float maxDrift;     // Maior |drift| observado
+    int seeks;          // Chamadas de VideoPlayer_Seek
+    int cacheHits;      // Frames decodificados a partir do cache em RAM
+    int cacheMisses;    // Frames que precisaram ler da origem
+    size_t cacheBytes;  // Bytes comprimidos residentes no cache
+} VideoPlayerStats;
+
+// Estado interno da decodificação em background (definido em video_player.c)
+typedef struct VideoDecoder VideoDecoder;
 
 typedef struct {
     int frameCount;
@@ -10,13 +38,41 @@ typedef struct {
     float frameTime;
     float timer;
     bool audioPlayed;
+    bool syncToAudio;       // Relógio mestre = áudio (GetMusicTimePlayed) em vez do delta do frame
+    float rate;             // Velocidade de reprodução (1.0 = normal)
     Music music;
+
+    Texture2D textures[VIDEO_TEXTURE_RING]; // Texturas persistentes, todas do mesmo tamanho/formato
+    int textureIndex;       // Slot do anel com o frame atualmente exibido
+    int textureFrame;       // Índice do frame exibido (-1 = nenhum)
+    int frameWidth;         // Tamanho real do frame (as texturas planares podem ser maiores)
+    int frameHeight;
+
+    // Caminho planar: textures[] guarda o plano Y e chroma[] os planos Cb/Cr (um canal cada);
+    // o shader converte para RGB no Draw. Usado automaticamente para JPEG baseline.
+    bool planar;
+    Texture2D chroma[VIDEO_TEXTURE_RING][2];
+    Shader yuvShader;
+    int chromaLocs[2];
+    VideoDecoder *decoder;
+    VideoPlayerStats stats;
 } VideoPlayer;
 
-bool VideoPlayer_Init(VideoPlayer *vp, const char *framesPathFormat, int frameCount, float fps, const char *audioPath);
+// framesSource: um arquivo .vpk (frameCount e fps vêm do próprio pack)
+// ou um formato printf para frames soltos, ex: "assets/frames/intro/frame_%04d.jpg"
+bool VideoPlayer_Init(VideoPlayer *vp, const char *framesSource, int frameCount, float fps, const char *audioPath);
 void VideoPlayer_Update(VideoPlayer *vp, float delta);
 void VideoPlayer_Draw(VideoPlayer *vp, int x, int y, int width, int height);
 void VideoPlayer_Unload(VideoPlayer *vp);
 bool VideoPlayer_IsFinished(VideoPlayer *vp);
 void VideoPlayer_Reset(VideoPlayer *vp); // ✅ adicionada
+// Pula para um instante do vídeo (o áudio acompanha); não bloqueia esperando o frame
+void VideoPlayer_Seek(VideoPlayer *vp, float seconds);
+float VideoPlayer_GetTime(VideoPlayer *vp);
+// Velocidade de reprodução (vídeo e áudio), limitada a [VIDEO_RATE_MIN, VIDEO_RATE_MAX]
+void VideoPlayer_SetRate(VideoPlayer *vp, float rate);
+// Cache em RAM dos frames comprimidos (para vídeos em loop). Chamar após o Init.
+bool VideoPlayer_EnableCache(VideoPlayer *vp, size_t budgetBytes);
+// Liga/desliga o sincronismo pelo áudio (ligado por padrão quando há áudio)
+void VideoPlayer_SetAudioSync(VideoPlayer *vp, bool enabled);
 #endif
@@ -0,0 +1,224 @@
+#include "asset_cache.h"
+#include "asset_prefetch.h"
+#include <stdio.h>
+#include <string.h>
+
+// --- ENTRADAS ---
+#define MAX_CACHE_ENTRIES 128
+#define CACHE_PATH_SIZE 128
+
+typedef enum {
+    CACHE_FREE = 0,
+    CACHE_TEXTURE,
+    CACHE_SOUND
+} CacheEntryKind;
+
+typedef struct {
+    CacheEntryKind kind;
+    char path[CACHE_PATH_SIZE];
+    Texture2D texture;
+    Sound sound;
+    size_t bytes;
+    int refCount;
+    unsigned int lastUse;   // Relógio lógico para o LRU
+} CacheEntry;
+
+static CacheEntry entries[MAX_CACHE_ENTRIES];
+static unsigned int useClock = 0;
+static size_t textureBudget = ASSET_CACHE_TEXTURE_BUDGET;
+static size_t soundBudget = ASSET_CACHE_SOUND_BUDGET;
+static AssetCacheStats stats = { 0 };
+
+static CacheEntry *FindByPath(CacheEntryKind kind, const char *path) {
+    for (int i = 0; i < MAX_CACHE_ENTRIES; i++) {
+        if (entries[i].kind == kind && strcmp(entries[i].path, path) == 0) return &entries[i];
+    }
+    return NULL;
+}
+
+static void ReleaseEntry(CacheEntry *entry) {
+    if (entry->kind == CACHE_TEXTURE) {
+        UnloadTexture(entry->texture);
+        stats.textureBytes -= entry->bytes;
+        stats.textureCount--;
+    } else if (entry->kind == CACHE_SOUND) {
+        UnloadSound(entry->sound);
+        stats.soundBytes -= entry->bytes;
+        stats.soundCount--;
+    }
+    memset(entry, 0, sizeof(*entry));
+}
+
+// Remove os assets sem referência menos usados até o tipo caber no orçamento.
+// Assets em uso nunca saem, mesmo que o orçamento estoure.
+static void EvictOverBudget(CacheEntryKind kind) {
+    size_t *used = (kind == CACHE_TEXTURE) ? &stats.textureBytes : &stats.soundBytes;
+    size_t budget = (kind == CACHE_TEXTURE) ? textureBudget : soundBudget;
+
+    while (*used > budget) {
+        CacheEntry *oldest = NULL;
+        for (int i = 0; i < MAX_CACHE_ENTRIES; i++) {
+            CacheEntry *entry = &entries[i];
+            if (entry->kind != kind || entry->refCount > 0) continue;
+            if (!oldest || entry->lastUse < oldest->lastUse) oldest = entry;
+        }
+        if (!oldest) break;
+
+        ReleaseEntry(oldest);
+        stats.evictions++;
+    }
+}
+
+// Slot livre; com a tabela cheia, reaproveita o asset sem referência menos usado
+static CacheEntry *AllocEntry(void) {
+    CacheEntry *oldest = NULL;
+    for (int i = 0; i < MAX_CACHE_ENTRIES; i++) {
+        CacheEntry *entry = &entries[i];
+        if (entry->kind == CACHE_FREE) return entry;
+        if (entry->refCount == 0 && (!oldest || entry->lastUse < oldest->lastUse)) oldest = entry;
+    }
+    if (!oldest) return NULL;
+
+    ReleaseEntry(oldest);
+    stats.evictions++;
+    return oldest;
+}
+
+static size_t TextureBytes(Texture2D texture) {
+    size_t bytes = (size_t)GetPixelDataSize(texture.width, texture.height, texture.format);
+    return (texture.mipmaps > 1) ? bytes + bytes / 3 : bytes;
+}
+
+// --- TEXTURAS ---
+Texture2D AssetCache_LoadTexture(const char *path) {
+    // Sem janela não há contexto GL (simulação headless): textura vazia, como um arquivo ausente
+    if (!IsWindowReady()) return (Texture2D){ 0 };
+
+    CacheEntry *entry = FindByPath(CACHE_TEXTURE, path);
+    if (entry) {
+        entry->refCount++;
+        entry->lastUse = ++useClock;
+        stats.hits++;
+        return entry->texture;
+    }
+    stats.misses++;
+
+    // Imagem já decodificada em background? Senão, disco + decodificação aqui mesmo
+    Texture2D texture;
+    Image image;
+    if (AssetPrefetch_TakeImage(path, &image)) {
+        texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+    } else {
+        texture = LoadTexture(path);
+    }
+    if (texture.id == 0) return texture;
+
+    entry = (strlen(path) < CACHE_PATH_SIZE) ? AllocEntry() : NULL;
+    if (!entry) {
+        printf("AVISO: Cache de assets cheio, '%s' fica fora do cache.\n", path);
+        return texture;
+    }
+
+    entry->kind = CACHE_TEXTURE;
+    snprintf(entry->path, sizeof(entry->path), "%s", path);
+    entry->texture = texture;
+    entry->bytes = TextureBytes(texture);
+    entry->refCount = 1;
+    entry->lastUse = ++useClock;
+    stats.textureBytes += entry->bytes;
+    stats.textureCount++;
+
+    EvictOverBudget(CACHE_TEXTURE);
+    return texture;
+}
+
+void AssetCache_UnloadTexture(Texture2D texture) {
+    if (texture.id == 0) return;
+
+    for (int i = 0; i < MAX_CACHE_ENTRIES; i++) {
+        CacheEntry *entry = &entries[i];
+        if (entry->kind != CACHE_TEXTURE || entry->texture.id != texture.id) continue;
+
+        // Fica residente sem referências; só sai se o orçamento exigir
+        if (entry->refCount > 0) entry->refCount--;
+        EvictOverBudget(CACHE_TEXTURE);
+        return;
+    }
+
+    // Não veio do cache (ficou de fora): libera direto
+    UnloadTexture(texture);
+}
+
+// --- SONS ---
+Sound AssetCache_LoadSound(const char *path) {
+    if (!IsAudioDeviceReady()) return (Sound){ 0 };
+
+    CacheEntry *entry = FindByPath(CACHE_SOUND, path);
+    if (entry) {
+        entry->refCount++;
+        entry->lastUse = ++useClock;
+        stats.hits++;
+        return entry->sound;
+    }
+    stats.misses++;
+
+    Sound sound = LoadSound(path);
+    if (sound.stream.buffer == NULL) return sound;
+
+    entry = (strlen(path) < CACHE_PATH_SIZE) ? AllocEntry() : NULL;
+    if (!entry) {
+        printf("AVISO: Cache de assets cheio, '%s' fica fora do cache.\n", path);
+        return sound;
+    }
+
+    entry->kind = CACHE_SOUND;
+    snprintf(entry->path, sizeof(entry->path), "%s", path);
+    entry->sound = sound;
+    entry->bytes = (size_t)sound.frameCount * sound.stream.channels * (sound.stream.sampleSize / 8);
+    entry->refCount = 1;
+    entry->lastUse = ++useClock;
+    stats.soundBytes += entry->bytes;
+    stats.soundCount++;
+
+    EvictOverBudget(CACHE_SOUND);
+    return sound;
+}
+
+void AssetCache_UnloadSound(Sound sound) {
+    if (sound.stream.buffer == NULL) return;
+
+    for (int i = 0; i < MAX_CACHE_ENTRIES; i++) {
+        CacheEntry *entry = &entries[i];
+        if (entry->kind != CACHE_SOUND || entry->sound.stream.buffer != sound.stream.buffer) continue;
+
+        if (entry->refCount > 0) entry->refCount--;
+        EvictOverBudget(CACHE_SOUND);
+        return;
+    }
+
+    UnloadSound(sound);
+}
+
+// --- CONTROLE ---
+void AssetCache_SetBudgets(size_t textureBytes, size_t soundBytes) {
+    textureBudget = textureBytes;
+    soundBudget = soundBytes;
+    EvictOverBudget(CACHE_TEXTURE);
+    EvictOverBudget(CACHE_SOUND);
+}
+
+AssetCacheStats AssetCache_GetStats(void) {
+    return stats;
+}
+
+void AssetCache_Shutdown(void) {
+    printf("AssetCache: %d acertos, %d falhas, %d despejos, %.1f MB de texturas, %.1f MB de sons\n",
+           stats.hits, stats.misses, stats.evictions,
+           stats.textureBytes / (1024.0f * 1024.0f), stats.soundBytes / (1024.0f * 1024.0f));
+
+    for (int i = 0; i < MAX_CACHE_ENTRIES; i++) {
+        if (entries[i].kind != CACHE_FREE) ReleaseEntry(&entries[i]);
+    }
+    useClock = 0;
+}
@@ -0,0 +1,217 @@
+#include "asset_prefetch.h"
+#include "atomic_ops.h"
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+
+// --- MANIFESTO ---
+// Imagens carregadas por cada tela no Init. Um caminho fora desta lista (ou que saiu
+// dela) só perde o pré-carregamento: a tela continua lendo do disco normalmente.
+#define MENU_CHARACTER_FRAMES 10
+#define PREFETCH_PATH_SIZE 64
+
+typedef struct {
+    const char *path;
+    PrefetchGroup group;
+} PrefetchManifestEntry;
+
+static const PrefetchManifestEntry manifest[] = {
+    // Lobby (game.c)
+    { "assets/tiles/player/idle/idle.png",                  PREFETCH_LOBBY },
+    { "assets/tiles/player/walk/walk.png",                  PREFETCH_LOBBY },
+    { "assets/arcades/fliperama_guitarhero.png",            PREFETCH_LOBBY },
+    { "assets/arcades/fliperama_quebrado_guitarhero.png",   PREFETCH_LOBBY },
+    { "assets/arcades/fliperama_byte.png",                  PREFETCH_LOBBY },
+    { "assets/arcades/fliperama_quebrado_byte.png",         PREFETCH_LOBBY },
+    { "assets/arcades/fliperama_insert.png",                PREFETCH_LOBBY },
+    { "assets/arcades/fliperama_quebrado_insert.png",       PREFETCH_LOBBY },
+
+    // Guitar Hero
+    { "assets/background.jpg",                              PREFETCH_MINIGAMES },
+
+    // Byte Space (player, tiros, HUD/loja, inimigos e cutscene final)
+    { "assets/byte2/images/sprites/byte_1.png",             PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/byte_2.png",             PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/byte_shield.png",        PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/byte_4.png",             PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/ataque_fraco.png",       PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/ataque_medio.png",       PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/ataque_forte.png",       PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/shurikens_byte.png",     PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/life_icon_large.png",    PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/energy_icon.png",        PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/icone_powerup_shurikens.png", PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/shield.png",             PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/gold.png",               PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/inimigo_1.png",          PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/inimigo_2.png",          PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/inimigo_3.png",          PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/1.png",                  PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/2.png",                  PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/3.png",                  PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/4.png",                  PREFETCH_MINIGAMES },
+    { "assets/byte2/images/sprites/5.png",                  PREFETCH_MINIGAMES },
+};
+
+#define MANIFEST_COUNT ((int)(sizeof(manifest) / sizeof(manifest[0])))
+#define MAX_PREFETCH_ITEMS (MENU_CHARACTER_FRAMES + MANIFEST_COUNT)
+
+// --- ESTADO ---
+typedef enum {
+    ITEM_PENDING = 0,   // Na fila da thread
+    ITEM_LOADING,       // Sendo lido/decodificado agora
+    ITEM_READY,         // Image pronta esperando a tela
+    ITEM_TAKEN,         // Entregue (ou cancelado) para a tela
+    ITEM_FAILED         // Arquivo ausente ou inválido
+} PrefetchItemState;
+
+typedef struct {
+    char path[PREFETCH_PATH_SIZE];
+    PrefetchGroup group;
+    int fileSize;
+    Image image;
+    int state;          // PrefetchItemState (acesso atômico)
+} PrefetchItem;
+
+static PrefetchItem items[MAX_PREFETCH_ITEMS];
+static int itemCount = 0;
+
+static int groupItemsDone[PREFETCH_GROUP_COUNT];
+static int groupItemsTotal[PREFETCH_GROUP_COUNT];
+static size_t groupBytesDone[PREFETCH_GROUP_COUNT];
+static size_t groupBytesTotal[PREFETCH_GROUP_COUNT];
+
+static pthread_t prefetchThread;
+static bool threadRunning = false;
+static int quitRequested = 0;
+
+static void AddItem(const char *path, PrefetchGroup group) {
+    PrefetchItem *item = &items[itemCount++];
+    snprintf(item->path, sizeof(item->path), "%s", path);
+    item->group = group;
+    item->fileSize = 0;
+    item->image = (Image){0};
+    item->state = ITEM_PENDING;
+    groupItemsTotal[group]++;
+}
+
+static void FinishItem(PrefetchItem *item) {
+    ATOMIC_ADD(&groupBytesDone[item->group], (size_t)item->fileSize);
+    ATOMIC_ADD(&groupItemsDone[item->group], 1);
+}
+
+static void *PrefetchWorker(void *arg) {
+    (void)arg;
+
+    // Mede os arquivos primeiro para que a barra de progresso tenha o total desde o início
+    for (int i = 0; i < itemCount; i++) {
+        items[i].fileSize = FileExists(items[i].path) ? GetFileLength(items[i].path) : 0;
+        ATOMIC_ADD(&groupBytesTotal[items[i].group], (size_t)items[i].fileSize);
+    }
+
+    for (int group = 0; group < PREFETCH_GROUP_COUNT; group++) {
+        for (int i = 0; i < itemCount; i++) {
+            PrefetchItem *item = &items[i];
+            if ((int)item->group != group) continue;
+            if (ATOMIC_LOAD(&quitRequested)) return NULL;
+
+            // A tela pode ter cancelado o item (pediu antes da thread chegar nele)
+            int expected = ITEM_PENDING;
+            if (!ATOMIC_CAS(&item->state, &expected, ITEM_LOADING)) {
+                FinishItem(item);
+                continue;
+            }
+
+            if (item->fileSize > 0) item->image = LoadImage(item->path);
+            ATOMIC_STORE(&item->state, item->image.data ? ITEM_READY : ITEM_FAILED);
+            FinishItem(item);
+        }
+    }
+
+    return NULL;
+}
+
+void AssetPrefetch_Start(void) {
+    if (threadRunning) return;
+
+    itemCount = 0;
+    for (int g = 0; g < PREFETCH_GROUP_COUNT; g++) {
+        groupItemsDone[g] = groupItemsTotal[g] = 0;
+        groupBytesDone[g] = groupBytesTotal[g] = 0;
+    }
+
+    char path[PREFETCH_PATH_SIZE];
+    for (int i = 0; i < MENU_CHARACTER_FRAMES; i++) {
+        snprintf(path, sizeof(path), "assets/character/frame%d.png", i + 1);
+        AddItem(path, PREFETCH_MENU);
+    }
+    for (int i = 0; i < MANIFEST_COUNT; i++) AddItem(manifest[i].path, manifest[i].group);
+
+    quitRequested = 0;
+    threadRunning = (pthread_create(&prefetchThread, NULL, PrefetchWorker, NULL) == 0);
+    if (!threadRunning) {
+        // Sem thread: nada fica pendente e as telas carregam tudo do disco
+        printf("AVISO: Falha ao iniciar o pre-carregamento de assets.\n");
+        itemCount = 0;
+        for (int g = 0; g < PREFETCH_GROUP_COUNT; g++) groupItemsTotal[g] = 0;
+    }
+}
+
+void AssetPrefetch_Shutdown(void) {
+    if (!threadRunning) return;
+
+    ATOMIC_STORE(&quitRequested, 1);
+    pthread_join(prefetchThread, NULL);
+    threadRunning = false;
+
+    int unused = 0;
+    for (int i = 0; i < itemCount; i++) {
+        if (items[i].state == ITEM_READY) {
+            UnloadImage(items[i].image);
+            unused++;
+        }
+        items[i].image = (Image){0};
+    }
+    if (unused > 0) printf("AssetPrefetch: %d imagens pre-carregadas nao foram usadas.\n", unused);
+    itemCount = 0;
+}
+
+bool AssetPrefetch_TakeImage(const char *path, Image *image) {
+    for (int i = 0; i < itemCount; i++) {
+        PrefetchItem *item = &items[i];
+        if (strcmp(item->path, path) != 0) continue;
+
+        int state = ATOMIC_LOAD(&item->state);
+
+        // Ainda não começou: cancela para a thread pular e a tela lê do disco
+        if (state == ITEM_PENDING && ATOMIC_CAS(&item->state, &state, ITEM_TAKEN)) return false;
+
+        // Já está sendo decodificada: esperar sai mais barato que ler de novo
+        while (state == ITEM_LOADING) {
+            sched_yield();
+            state = ATOMIC_LOAD(&item->state);
+        }
+
+        if (state != ITEM_READY) return false; // Falhou ou já foi entregue antes
+
+        *image = item->image;
+        item->image = (Image){0};
+        ATOMIC_STORE(&item->state, ITEM_TAKEN);
+        return true;
+    }
+    return false;
+}
+
+PrefetchProgress AssetPrefetch_GetProgress(PrefetchGroup group) {
+    PrefetchProgress progress;
+    progress.itemsDone = ATOMIC_LOAD(&groupItemsDone[group]);
+    progress.itemsTotal = groupItemsTotal[group];
+    progress.bytesDone = ATOMIC_LOAD(&groupBytesDone[group]);
+    progress.bytesTotal = ATOMIC_LOAD(&groupBytesTotal[group]);
+    return progress;
+}
+
+bool AssetPrefetch_IsGroupDone(PrefetchGroup group) {
+    return ATOMIC_LOAD(&groupItemsDone[group]) >= groupItemsTotal[group];
+}
@@ -0,0 +1,243 @@
+#include "b2_atlas.h"
+#include "raylib.h"
+#include "asset_prefetch.h"
+#include <stdio.h>
+#include <string.h>
+
+// --- GLOBAL ---
+B2Atlas b2Atlas = { 0 };
+
+// --- CAMINHOS DOS SPRITES ---
+#define SPRITES_DIR "assets/byte2/images/sprites/"
+
+// Frames do Boss na ordem da animação (o GIF original começa no frame 04).
+// O último índice fica sem arquivo e não é desenhado, como antes.
+static const char *bossFramePaths[BOSS_FRAME_COUNT] = {
+    SPRITES_DIR "frame_04_delay-0.08s.gif",
+    SPRITES_DIR "frame_05_delay-0.08s.gif",
+    SPRITES_DIR "frame_06_delay-0.08s.gif",
+    SPRITES_DIR "frame_07_delay-0.08s.gif",
+    SPRITES_DIR "frame_08_delay-0.08s.gif",
+    SPRITES_DIR "frame_09_delay-0.08s.gif",
+    SPRITES_DIR "frame_10_delay-0.08s.gif",
+    SPRITES_DIR "frame_11_delay-0.08s.gif",
+    SPRITES_DIR "frame_12_delay-0.08s.gif",
+    SPRITES_DIR "frame_13_delay-0.08s.gif",
+    SPRITES_DIR "frame_14_delay-0.08s.gif",
+    SPRITES_DIR "frame_15_delay-0.08s.gif",
+    SPRITES_DIR "frame_16_delay-0.08s.gif",
+    SPRITES_DIR "frame_17_delay-0.08s.gif",
+    SPRITES_DIR "frame_18_delay-0.08s.gif",
+    SPRITES_DIR "frame_19_delay-0.08s.gif",
+    SPRITES_DIR "frame_20_delay-0.08s.gif",
+    SPRITES_DIR "frame_21_delay-0.08s.gif",
+    SPRITES_DIR "frame_22_delay-0.08s.gif",
+    SPRITES_DIR "frame_23_delay-0.08s.gif",
+    SPRITES_DIR "frame_24_delay-0.08s.gif",
+    SPRITES_DIR "frame_25_delay-0.08s.gif",
+    SPRITES_DIR "frame_26_delay-0.08s.gif",
+    SPRITES_DIR "frame_27_delay-0.08s.gif",
+    SPRITES_DIR "frame_28_delay-0.08s.gif",
+    SPRITES_DIR "frame_00_delay-0.08s.gif",
+    SPRITES_DIR "frame_01_delay-0.08s.gif",
+    SPRITES_DIR "frame_02_delay-0.08s.gif",
+    SPRITES_DIR "frame_03_delay-0.08s.gif",
+};
+
+static const char *GetSpritePath(B2SpriteId id) {
+    if (id >= B2_SPRITE_BOSS_FRAME_0 && id <= B2_SPRITE_BOSS_FRAME_LAST) {
+        return bossFramePaths[id - B2_SPRITE_BOSS_FRAME_0];
+    }
+
+    switch (id) {
+        case B2_SPRITE_ENEMY_1:         return SPRITES_DIR "inimigo_1.png";
+        case B2_SPRITE_ENEMY_2:         return SPRITES_DIR "inimigo_2.png";
+        case B2_SPRITE_ENEMY_3:         return SPRITES_DIR "inimigo_3.png";
+        case B2_SPRITE_BULLET_WEAK:     return SPRITES_DIR "ataque_fraco.png";
+        case B2_SPRITE_BULLET_MEDIUM:   return SPRITES_DIR "ataque_medio.png";
+        case B2_SPRITE_BULLET_STRONG:   return SPRITES_DIR "ataque_forte.png";
+        case B2_SPRITE_BULLET_SHURIKEN: return SPRITES_DIR "shurikens_byte.png";
+        case B2_SPRITE_ICON_LIFE:       return SPRITES_DIR "life_icon_large.png";
+        case B2_SPRITE_ICON_ENERGY:     return SPRITES_DIR "energy_icon.png";
+        case B2_SPRITE_ICON_SHURIKEN:   return SPRITES_DIR "icone_powerup_shurikens.png";
+        case B2_SPRITE_ICON_SHIELD:     return SPRITES_DIR "shield.png";
+        case B2_SPRITE_ICON_GOLD:       return SPRITES_DIR "gold.png";
+        default:                        return NULL;
+    }
+}
+
+// Tiros e ícones são pixel art (o jogo sempre os desenhou com TEXTURE_FILTER_POINT): vão
+// para páginas próprias, sem filtro. Inimigos, Boss e auras ficam nas páginas bilineares.
+static bool IsPixelArtSprite(B2SpriteId id) {
+    return id >= B2_SPRITE_BULLET_WEAK && id <= B2_SPRITE_ICON_GOLD;
+}
+
+// --- CARREGAMENTO DAS IMAGENS ---
+// Sprites sem arquivo, desenhados na CPU
+static Image GenerateSpriteImage(B2SpriteId id, B2Sprite *sprite) {
+    Image image = { 0 };
+    if (id >= B2_SPRITE_AURA_1 && id <= B2_SPRITE_AURA_3) {
+        image = GenEnemyAuraImage(1 + (id - B2_SPRITE_AURA_1), ENEMY_AURA_TEXTURE_SIZE);
+    }
+    if (image.data == NULL) return image;
+
+    sprite->width = (float)image.width;
+    sprite->height = (float)image.height;
+    return image;
+}
+
+static Image LoadSpriteImage(B2SpriteId id, B2Sprite *sprite) {
+    Image image = { 0 };
+    const char *path = GetSpritePath(id);
+    if (path == NULL) return GenerateSpriteImage(id, sprite);
+
+    // A thread de pré-carregamento pode já ter decodificado o PNG durante a intro/lobby
+    if (!AssetPrefetch_TakeImage(path, &image)) {
+        if (!FileExists(path)) {
+            printf("[ERRO] Sprite do atlas nao encontrado: %s\n", path);
+            return image;
+        }
+        image = LoadImage(path);
+    }
+    if (image.data == NULL) return image;
+
+    ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    // Tamanho original (antes da redução) para manter as escalas e colisões do jogo
+    sprite->width = (float)image.width;
+    sprite->height = (float)image.height;
+
+    // Reduz na CPU o que seria reduzido na tela: o maior sprite aparece com ~160px no alvo
+    // de 800x600, então 256px sobra. Pixel art reduz por vizinho mais próximo (sem borrar)
+    int longest = (image.width > image.height) ? image.width : image.height;
+    if (longest > B2_ATLAS_MAX_SPRITE_SIZE) {
+        int newWidth = image.width * B2_ATLAS_MAX_SPRITE_SIZE / longest;
+        int newHeight = image.height * B2_ATLAS_MAX_SPRITE_SIZE / longest;
+        if (newWidth < 1) newWidth = 1;
+        if (newHeight < 1) newHeight = 1;
+        if (IsPixelArtSprite(id)) ImageResizeNN(&image, newWidth, newHeight);
+        else ImageResize(&image, newWidth, newHeight);
+    }
+    return image;
+}
+
+// Copia os pixels linha a linha (sem blending) para a posição reservada na página
+static void CopyIntoPage(Image *page, Image *sprite, int x, int y) {
+    unsigned char *dst = (unsigned char *)page->data;
+    unsigned char *src = (unsigned char *)sprite->data;
+    for (int row = 0; row < sprite->height; row++) {
+        memcpy(dst + ((size_t)(y + row) * page->width + x) * 4,
+               src + (size_t)row * sprite->width * 4,
+               (size_t)sprite->width * 4);
+    }
+}
+
+// --- EMPACOTAMENTO ---
+void InitB2Atlas(void) {
+    if (b2Atlas.pageCount > 0) return; // Já residente de uma visita anterior
+
+    static Image images[B2_SPRITE_COUNT];
+    int order[B2_SPRITE_COUNT];
+    int orderCount = 0;
+
+    for (int i = 0; i < B2_SPRITE_COUNT; i++) {
+        b2Atlas.sprites[i] = (B2Sprite){ .page = -1 };
+        images[i] = LoadSpriteImage((B2SpriteId)i, &b2Atlas.sprites[i]);
+        if (images[i].data == NULL) continue;
+
+        // Ordena por altura decrescente (inserção): prateleiras ficam mais cheias
+        int pos = orderCount++;
+        while (pos > 0 && images[order[pos - 1]].height < images[i].height) {
+            order[pos] = order[pos - 1];
+            pos--;
+        }
+        order[pos] = i;
+    }
+
+    // Shelf packing: sprites lado a lado; quando a linha enche, abre uma prateleira abaixo.
+    // Uma passada por filtro, cada uma começando numa página nova
+    static const int filters[2] = { TEXTURE_FILTER_POINT, TEXTURE_FILTER_BILINEAR };
+    int pageUsedHeight[B2_ATLAS_MAX_PAGES] = { 0 };
+    int pageCount = 0;
+
+    for (int f = 0; f < 2; f++) {
+        int page = -1, shelfX = 0, shelfY = 0, shelfHeight = 0;
+
+        for (int n = 0; n < orderCount; n++) {
+            int i = order[n];
+            if (IsPixelArtSprite((B2SpriteId)i) != (filters[f] == TEXTURE_FILTER_POINT)) continue;
+            int w = images[i].width + B2_ATLAS_PADDING;
+            int h = images[i].height + B2_ATLAS_PADDING;
+
+            if (shelfX + w > B2_ATLAS_PAGE_SIZE) {
+                shelfY += shelfHeight;
+                shelfX = 0;
+                shelfHeight = 0;
+            }
+            if (page < 0 || shelfY + h > B2_ATLAS_PAGE_SIZE) {
+                if (pageCount >= B2_ATLAS_MAX_PAGES) {
+                    printf("[ERRO] Atlas do Byte Space cheio, sprite ignorado: %s\n", GetSpritePath((B2SpriteId)i));
+                    continue;
+                }
+                page = pageCount++;
+                b2Atlas.pageFilters[page] = filters[f];
+                shelfX = shelfY = shelfHeight = 0;
+            }
+
+            B2Sprite *sprite = &b2Atlas.sprites[i];
+            sprite->page = page;
+            sprite->source = (Rectangle){ (float)shelfX, (float)shelfY, (float)images[i].width, (float)images[i].height };
+
+            shelfX += w;
+            if (h > shelfHeight) shelfHeight = h;
+            if (shelfY + h > pageUsedHeight[page]) pageUsedHeight[page] = shelfY + h;
+        }
+    }
+    b2Atlas.pageCount = pageCount;
+
+    // Monta cada página na CPU e envia uma única textura para a GPU
+    for (int p = 0; p < b2Atlas.pageCount; p++) {
+        int pageHeight = (pageUsedHeight[p] + 3) & ~3; // Só a altura usada (múltiplo de 4)
+        Image pageImage = GenImageColor(B2_ATLAS_PAGE_SIZE, pageHeight, BLANK);
+
+        for (int i = 0; i < B2_SPRITE_COUNT; i++) {
+            if (b2Atlas.sprites[i].page != p) continue;
+            CopyIntoPage(&pageImage, &images[i], (int)b2Atlas.sprites[i].source.x, (int)b2Atlas.sprites[i].source.y);
+        }
+
+        b2Atlas.pages[p] = LoadTextureFromImage(pageImage);
+        // Páginas suaves: os sprites já foram reduzidos com filtro na CPU e o bilinear suaviza
+        // a escala final. Páginas de pixel art: point, como as texturas soltas de antes
+        SetTextureFilter(b2Atlas.pages[p], b2Atlas.pageFilters[p]);
+        UnloadImage(pageImage);
+    }
+
+    for (int i = 0; i < B2_SPRITE_COUNT; i++) {
+        if (images[i].data != NULL) UnloadImage(images[i]);
+        images[i] = (Image){ 0 };
+    }
+
+    printf("B2Atlas: %d sprites em %d pagina(s) de %dpx\n", orderCount, b2Atlas.pageCount, B2_ATLAS_PAGE_SIZE);
+}
+
+// --- ACESSO ---
+bool IsB2SpriteLoaded(B2SpriteId id) {
+    return id >= 0 && id < B2_SPRITE_COUNT && b2Atlas.sprites[id].page >= 0;
+}
+
+void DrawB2Sprite(B2SpriteId id, Rectangle dest, Vector2 origin, float rotation, Color tint) {
+    if (!IsB2SpriteLoaded(id)) return;
+
+    const B2Sprite *sprite = &b2Atlas.sprites[id];
+    DrawTexturePro(b2Atlas.pages[sprite->page], sprite->source, dest, origin, rotation, tint);
+}
+
+// --- FINALIZAÇÃO ---
+void UnloadB2Atlas(void) {
+    for (int p = 0; p < b2Atlas.pageCount; p++) {
+        if (b2Atlas.pages[p].id != 0) UnloadTexture(b2Atlas.pages[p]);
+        b2Atlas.pages[p] = (Texture2D){ 0 };
+    }
+    b2Atlas.pageCount = 0;
+    for (int i = 0; i < B2_SPRITE_COUNT; i++) b2Atlas.sprites[i].page = -1;
+}
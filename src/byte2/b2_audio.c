@@ -1,5 +1,6 @@
 #include "b2_audio.h"
 #include "raylib.h"
+#include "asset_cache.h"
 #include <stddef.h> // Para NULL
 
 // --- DEFINIÇÃO DA VARIÁVEL GLOBAL ---
@@ -22,11 +23,11 @@ void InitAudioManager(AudioManager *manager) {
     manager->currentMusic = NULL;
 
     // Inicializa SFX
-    if (FileExists("assets/byte2/audio/sfx_weak.wav")) manager->sfxWeak = LoadSound("assets/byte2/audio/sfx_weak.wav");
-    if (FileExists("assets/byte2/audio/sfx_medium.wav")) manager->sfxMedium = LoadSound("assets/byte2/audio/sfx_medium.wav");
-    if (FileExists("assets/byte2/audio/sfx_strong.wav")) manager->sfxStrong = LoadSound("assets/byte2/audio/sfx_strong.wav");
-    if (FileExists("assets/byte2/audio/sfx_charge.wav")) manager->sfxCharge = LoadSound("assets/byte2/audio/sfx_charge.wav");
-    if (FileExists("assets/byte2/audio/sfx_explosion.wav")) manager->sfxExplosionEnemy = LoadSound("assets/byte2/audio/sfx_explosion.wav");
+    if (FileExists("assets/byte2/audio/sfx_weak.wav")) manager->sfxWeak = AssetCache_LoadSound("assets/byte2/audio/sfx_weak.wav");
+    if (FileExists("assets/byte2/audio/sfx_medium.wav")) manager->sfxMedium = AssetCache_LoadSound("assets/byte2/audio/sfx_medium.wav");
+    if (FileExists("assets/byte2/audio/sfx_strong.wav")) manager->sfxStrong = AssetCache_LoadSound("assets/byte2/audio/sfx_strong.wav");
+    if (FileExists("assets/byte2/audio/sfx_charge.wav")) manager->sfxCharge = AssetCache_LoadSound("assets/byte2/audio/sfx_charge.wav");
+    if (FileExists("assets/byte2/audio/sfx_explosion.wav")) manager->sfxExplosionEnemy = AssetCache_LoadSound("assets/byte2/audio/sfx_explosion.wav");
 }
 
 void UpdateAudioManager(AudioManager *manager) {
@@ -83,9 +84,9 @@ void UnloadAudioManager(AudioManager *manager) {
     if (manager->musicEnding.stream.buffer) UnloadMusicStream(manager->musicEnding);
 
     // Descarrega SFX
-    if (manager->sfxWeak.stream.buffer) UnloadSound(manager->sfxWeak);
-    if (manager->sfxMedium.stream.buffer) UnloadSound(manager->sfxMedium);
-    if (manager->sfxStrong.stream.buffer) UnloadSound(manager->sfxStrong);
-    if (manager->sfxCharge.stream.buffer) UnloadSound(manager->sfxCharge);
-    if (manager->sfxExplosionEnemy.stream.buffer) UnloadSound(manager->sfxExplosionEnemy);
+    if (manager->sfxWeak.stream.buffer) AssetCache_UnloadSound(manager->sfxWeak);
+    if (manager->sfxMedium.stream.buffer) AssetCache_UnloadSound(manager->sfxMedium);
+    if (manager->sfxStrong.stream.buffer) AssetCache_UnloadSound(manager->sfxStrong);
+    if (manager->sfxCharge.stream.buffer) AssetCache_UnloadSound(manager->sfxCharge);
+    if (manager->sfxExplosionEnemy.stream.buffer) AssetCache_UnloadSound(manager->sfxExplosionEnemy);
 }
\ No newline at end of file
@@ -1,75 +1,58 @@
 #include "b2_bullet.h"
 #include "raylib.h"
+#include "b2_atlas.h"
 #include "raymath.h"
 #include <stdio.h>
 #include <stdbool.h>
 
-// --- CONSTANTES DE ESCALA E CAMINHOS ---
+// --- CONSTANTES DE ESCALA ---
 #define BULLET_SCALE_WEAK 0.08f
 #define BULLET_SCALE_MEDIUM 0.12f
 #define BULLET_SCALE_STRONG 0.16f
 #define SHURIKEN_SCALE 0.1f
 
-#define WEAK_SPRITE_PATH "assets/byte2/images/sprites/ataque_fraco.png"
-#define MEDIUM_SPRITE_PATH "assets/byte2/images/sprites/ataque_medio.png"
-#define STRONG_SPRITE_PATH "assets/byte2/images/sprites/ataque_forte.png"
-#define SHURIKEN_SPRITE_PATH "assets/byte2/images/sprites/shurikens_byte.png"
+// Lado dos PNGs dos projéteis (ataque_*.png e shurikens_byte.png são 1024x1024). A colisão
+// usa esta constante, não o atlas: a simulação headless roda sem texturas
+#define BULLET_SPRITE_SIZE 1024.0f
+
+// Os sprites dos projéteis (ataque_fraco/medio/forte e shurikens_byte.png) ficam no atlas (b2_atlas.c)
 
 // --- CONSTANTES DE SHURIKEN ---
 #define SHURIKEN_BASE_SPEED 550.0f
 #define SHURIKEN_OFFSET 25.0f // Espaçamento horizontal em relação ao centro
 #define SHURIKEN_ANGLE 10.0f // Ângulo de desvio lateral em graus
 
-// --- FUNÇÃO AUXILIAR: Disparo de uma única bala ---
-static void FireBullet(BulletManager *manager, Vector2 position, Vector2 speed, float scale, int type, Texture2D texture) {
-    // Procura por uma bala inativa no array
-    for (int i = 0; i < MAX_PLAYER_BULLETS; i++) {
-        if (!manager->bullets[i].active) {
-            Bullet *bullet = &manager->bullets[i];
-
-            bullet->active = true;
-            bullet->type = type;
-
-            bullet->speed = speed;
+// Largura da área de jogo (a render texture do Byte Space), não a da janela: a simulação
+// não pode depender do tamanho do monitor
+#define BULLET_AREA_WIDTH 800.0f
 
-            // Define o tamanho da caixa de colisão/desenho baseado na escala
-            bullet->rect.width = (float)texture.width * scale;
-            bullet->rect.height = (float)texture.height * scale;
-
-            // Centraliza o retângulo na posição inicial
-            bullet->rect.x = position.x - (bullet->rect.width / 2);
-            bullet->rect.y = position.y - (bullet->rect.height / 2);
-
-            return; // Sai após disparar a bala
-        }
-    }
+// --- FUNÇÃO AUXILIAR: Disparo de uma única bala ---
+static void FireBullet(BulletManager *manager, Vector2 position, Vector2 speed, float scale, int type) {
+    // Pega um slot livre do pool (O(1)); cheio, o tiro não sai
+    Bullet *bullet = BulletPool_Acquire(&manager->bullets);
+    if (!bullet) return;
+
+    bullet->type = type;
+    bullet->color = WHITE;
+    bullet->speed = speed;
+
+    // Define o tamanho da caixa de colisão/desenho baseado na escala (tamanho original do arquivo)
+    bullet->rect.width = BULLET_SPRITE_SIZE * scale;
+    bullet->rect.height = BULLET_SPRITE_SIZE * scale;
+
+    // Centraliza o retângulo na posição inicial
+    bullet->rect.x = position.x - (bullet->rect.width / 2);
+    bullet->rect.y = position.y - (bullet->rect.height / 2);
 }
 
 // --- INICIALIZAÇÃO ---
 void InitBulletManager(BulletManager *manager) {
-    // Carrega as texturas dos projéteis
-    manager->weakTexture = LoadTexture(WEAK_SPRITE_PATH);
-    manager->mediumTexture = LoadTexture(MEDIUM_SPRITE_PATH);
-    manager->strongTexture = LoadTexture(STRONG_SPRITE_PATH);
-    manager->shurikenTexture = LoadTexture(SHURIKEN_SPRITE_PATH);
-
-    // Aplica filtro de ponto para manter a qualidade de pixel art
-    if (manager->weakTexture.id != 0) SetTextureFilter(manager->weakTexture, TEXTURE_FILTER_POINT);
-    if (manager->mediumTexture.id != 0) SetTextureFilter(manager->mediumTexture, TEXTURE_FILTER_POINT);
-    if (manager->strongTexture.id != 0) SetTextureFilter(manager->strongTexture, TEXTURE_FILTER_POINT);
-    if (manager->shurikenTexture.id != 0) SetTextureFilter(manager->shurikenTexture, TEXTURE_FILTER_POINT);
-
-    // Inicializa todas as balas como inativas
-    for (int i = 0; i < MAX_PLAYER_BULLETS; i++) {
-        manager->bullets[i].active = false;
-        manager->bullets[i].color = WHITE;
-        manager->bullets[i].speed = (Vector2){ 0, 0 };
-    }
+    // Todas as balas começam livres
+    BulletPool_Clear(&manager->bullets);
 }
 
 // --- DISPARO DE ATAQUE CARREGADO ---
 void ShootChargedAttack(BulletManager *manager, Vector2 playerCenter, float playerHeight, int attackType, bool hasShurikens) {
-    Texture2D mainTexture;
     float mainSpeed = 0.0f;
     float mainScale = 0.0f;
 
@@ -79,19 +62,16 @@ void ShootChargedAttack(BulletManager *manager, Vector2 playerCenter, float play
     // 1. Configuração do Projétil Principal (Weak, Medium ou Strong)
     switch (attackType) {
         case ATTACK_STRONG:
-            mainTexture = manager->strongTexture;
             mainSpeed = 700.0f;
             mainScale = BULLET_SCALE_STRONG;
             shouldFireShurikens = false; // Ataque FORTE não dispara shurikens
             break;
         case ATTACK_MEDIUM:
-            mainTexture = manager->mediumTexture;
             mainSpeed = 600.0f;
             mainScale = BULLET_SCALE_MEDIUM;
             shouldFireShurikens = false; // Ataque MÉDIO não dispara shurikens
             break;
         case ATTACK_WEAK: default:
-            mainTexture = manager->weakTexture;
             mainSpeed = 500.0f;
             mainScale = BULLET_SCALE_WEAK;
             // Se for ATTACK_WEAK, shouldFireShurikens mantém o valor original (depende do upgrade)
@@ -103,7 +83,7 @@ void ShootChargedAttack(BulletManager *manager, Vector2 playerCenter, float play
     Vector2 mainSpeedVec = { 0, -mainSpeed }; // Vertical para cima
 
     // Dispara o projétil principal
-    FireBullet(manager, mainPosition, mainSpeedVec, mainScale, attackType, mainTexture);
+    FireBullet(manager, mainPosition, mainSpeedVec, mainScale, attackType);
 
     // 2. Configuração e Disparo dos Shurikens (se permitido)
     if (shouldFireShurikens) {
@@ -118,87 +98,85 @@ void ShootChargedAttack(BulletManager *manager, Vector2 playerCenter, float play
         Vector2 pos1 = { startPosition.x - SHURIKEN_OFFSET, startPosition.y };
         // Rotaciona o vetor de velocidade 10 graus para a esquerda (negativo)
         Vector2 speed1 = Vector2Rotate(baseSpeedVector, -SHURIKEN_ANGLE * DEG2RAD);
-        FireBullet(manager, pos1, speed1, SHURIKEN_SCALE, ATTACK_SHURIKEN, manager->shurikenTexture);
+        FireBullet(manager, pos1, speed1, SHURIKEN_SCALE, ATTACK_SHURIKEN);
 
         // Shuriken Direito
         Vector2 pos2 = { startPosition.x + SHURIKEN_OFFSET, startPosition.y };
         // Rotaciona o vetor de velocidade 10 graus para a direita (positivo)
         Vector2 speed2 = Vector2Rotate(baseSpeedVector, SHURIKEN_ANGLE * DEG2RAD);
-        FireBullet(manager, pos2, speed2, SHURIKEN_SCALE, ATTACK_SHURIKEN, manager->shurikenTexture);
+        FireBullet(manager, pos2, speed2, SHURIKEN_SCALE, ATTACK_SHURIKEN);
     }
 }
 
 // --- ATUALIZAÇÃO ---
 void UpdatePlayerBullets(BulletManager *manager, float deltaTime) {
-    for (int i = 0; i < MAX_PLAYER_BULLETS; i++) {
-        if (manager->bullets[i].active) {
-            Bullet *bullet = &manager->bullets[i];
-
-            // Atualiza a posição (X += VelocidadeX * dT, Y += VelocidadeY * dT)
-            bullet->rect.x += bullet->speed.x * deltaTime;
-            bullet->rect.y += bullet->speed.y * deltaTime;
-
-            // Desativa a bala se sair da tela (acima ou nas laterais)
-            if (bullet->rect.y < -bullet->rect.height ||
-                bullet->rect.x < -bullet->rect.width ||
-                bullet->rect.x > GetScreenWidth()) {
-                bullet->active = false;
-            }
+    BulletPool *pool = &manager->bullets;
+
+    // Só as vivas; a que sai é trocada pela última viva, então k não avança nesse caso
+    for (int k = 0; k < pool->ids.count; ) {
+        int id = pool->ids.dense[k];
+        Bullet *bullet = &pool->items[id];
+
+        // Atualiza a posição (X += VelocidadeX * dT, Y += VelocidadeY * dT)
+        bullet->rect.x += bullet->speed.x * deltaTime;
+        bullet->rect.y += bullet->speed.y * deltaTime;
+
+        // Devolve a bala ao pool se sair da tela (acima ou nas laterais)
+        if (bullet->rect.y < -bullet->rect.height ||
+            bullet->rect.x < -bullet->rect.width ||
+            bullet->rect.x > BULLET_AREA_WIDTH) {
+            BulletPool_Release(pool, id);
+        } else {
+            k++;
         }
     }
 }
 
 // --- DESENHO ---
 void DrawPlayerBullets(BulletManager *manager) {
-    Texture2D currentTexture;
-
-    for (int i = 0; i < MAX_PLAYER_BULLETS; i++) {
-        if (manager->bullets[i].active) {
-            Bullet *bullet = &manager->bullets[i];
-
-            // Seleciona a textura correta
-            switch (bullet->type) {
-                case ATTACK_STRONG: currentTexture = manager->strongTexture; break;
-                case ATTACK_MEDIUM: currentTexture = manager->mediumTexture; break;
-                case ATTACK_SHURIKEN: currentTexture = manager->shurikenTexture; break;
-                case ATTACK_WEAK: default: currentTexture = manager->weakTexture; break;
-            }
-
-            Rectangle sourceRec = { 0.0f, 0.0f, (float)currentTexture.width, (float)currentTexture.height };
-
-            float rotation = 0.0f;
-
-            // Rotação especial para o Shuriken (gira constantemente)
-            if (bullet->type == ATTACK_SHURIKEN) {
-                rotation = fmod(GetTime() * 500.0f, 360.0f);
-            }
-
-            // O centro da textura para rotação e desenho
-            Vector2 origin = { bullet->rect.width / 2.0f, bullet->rect.height / 2.0f };
-
-            // Desenha a textura usando DrawTexturePro para aplicar escala, rotação e origem
-            DrawTexturePro(
-                currentTexture,
-                sourceRec,
-                (Rectangle){
-                    // Posição ajustada: Raylib Pro desenha o centro da textura no X/Y
-                    bullet->rect.x + origin.x,
-                    bullet->rect.y + origin.y,
-                    bullet->rect.width,
-                    bullet->rect.height
-                },
-                origin,
-                rotation,
-                WHITE
-            );
+    B2SpriteId currentSprite;
+
+    // Todos os tipos de projétil estão no mesmo atlas: o laço inteiro vira um único batch
+    for (int k = 0; k < BulletPool_Count(&manager->bullets); k++) {
+        Bullet *bullet = BulletPool_At(&manager->bullets, k);
+
+        // Seleciona o sprite correto
+        switch (bullet->type) {
+            case ATTACK_STRONG: currentSprite = B2_SPRITE_BULLET_STRONG; break;
+            case ATTACK_MEDIUM: currentSprite = B2_SPRITE_BULLET_MEDIUM; break;
+            case ATTACK_SHURIKEN: currentSprite = B2_SPRITE_BULLET_SHURIKEN; break;
+            case ATTACK_WEAK: default: currentSprite = B2_SPRITE_BULLET_WEAK; break;
         }
+
+        float rotation = 0.0f;
+
+        // Rotação especial para o Shuriken (gira constantemente)
+        if (bullet->type == ATTACK_SHURIKEN) {
+            rotation = fmod(GetTime() * 500.0f, 360.0f);
+        }
+
+        // O centro da textura para rotação e desenho
+        Vector2 origin = { bullet->rect.width / 2.0f, bullet->rect.height / 2.0f };
+
+        // Desenha o sub-retângulo do atlas aplicando escala, rotação e origem
+        DrawB2Sprite(
+            currentSprite,
+            (Rectangle){
+                // Posição ajustada: Raylib Pro desenha o centro da textura no X/Y
+                bullet->rect.x + origin.x,
+                bullet->rect.y + origin.y,
+                bullet->rect.width,
+                bullet->rect.height
+            },
+            origin,
+            rotation,
+            WHITE
+        );
     }
 }
 
 // --- DESCARREGAMENTO ---
 void UnloadBulletManager(BulletManager *manager) {
-    if (manager->weakTexture.id != 0) UnloadTexture(manager->weakTexture);
-    if (manager->mediumTexture.id != 0) UnloadTexture(manager->mediumTexture);
-    if (manager->strongTexture.id != 0) UnloadTexture(manager->strongTexture);
-    if (manager->shurikenTexture.id != 0) UnloadTexture(manager->shurikenTexture);
-}
\ No newline at end of file
+    // Os sprites pertencem ao atlas (UnloadB2Atlas); só devolve as balas restantes ao pool
+    BulletPool_Clear(&manager->bullets);
+}
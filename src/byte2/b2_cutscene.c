@@ -1,5 +1,6 @@
 #include "b2_cutscene.h"
 #include "raylib.h"
+#include "asset_cache.h"
 #include "raymath.h"
 #include "b2_game_state.h"
 #include "b2_audio.h"
@@ -50,13 +51,13 @@ void InitEnding(CutsceneScene *cs) {
     }
 
     // 2. Carrega sprites (Caminhos corrigidos e verificados)
-    if (FileExists("assets/byte2/images/sprites/1.png")) cs->endingImages[0] = LoadTexture("assets/byte2/images/sprites/1.png");
-    if (FileExists("assets/byte2/images/sprites/2.png")) cs->endingImages[1] = LoadTexture("assets/byte2/images/sprites/2.png");
-    if (FileExists("assets/byte2/images/sprites/3.png")) cs->endingImages[2] = LoadTexture("assets/byte2/images/sprites/3.png");
-    if (FileExists("assets/byte2/images/sprites/4.png")) cs->endingImages[3] = LoadTexture("assets/byte2/images/sprites/4.png");
+    if (FileExists("assets/byte2/images/sprites/1.png")) cs->endingImages[0] = AssetCache_LoadTexture("assets/byte2/images/sprites/1.png");
+    if (FileExists("assets/byte2/images/sprites/2.png")) cs->endingImages[1] = AssetCache_LoadTexture("assets/byte2/images/sprites/2.png");
+    if (FileExists("assets/byte2/images/sprites/3.png")) cs->endingImages[2] = AssetCache_LoadTexture("assets/byte2/images/sprites/3.png");
+    if (FileExists("assets/byte2/images/sprites/4.png")) cs->endingImages[3] = AssetCache_LoadTexture("assets/byte2/images/sprites/4.png");
 
     // CORREÇÃO: Havia um erro de digitação aqui ("byte2/byte2")
-    if (FileExists("assets/byte2/images/sprites/5.png")) cs->endingImages[4] = LoadTexture("assets/byte2/images/sprites/5.png");
+    if (FileExists("assets/byte2/images/sprites/5.png")) cs->endingImages[4] = AssetCache_LoadTexture("assets/byte2/images/sprites/5.png");
 
     cs->endingImageIndex = 0;
 
@@ -64,18 +65,18 @@ void InitEnding(CutsceneScene *cs) {
 }
 
 // --- FUNÇÃO DE UPDATE ---
-void UpdateCutscene(CutsceneScene *cs, GameState *state, float deltaTime) {
+void UpdateCutscene(CutsceneScene *cs, GameState *state, const B2Input *input, float deltaTime) {
 
     // >>> LÓGICA DO FINAL (QUADRINHOS) <<<
     if (cs->isEnding) {
-        if (IsKeyPressed(KEY_Z)) {
+        if (IsB2ButtonPressed(input, B2_BUTTON_NEXT)) {
             cs->endingImageIndex++;
 
             // Se passar da última imagem
             if (cs->endingImageIndex > 4) {
                 // Descarrega texturas
                 for(int i=0; i<5; i++) {
-                    if (cs->endingImages[i].id > 0) UnloadTexture(cs->endingImages[i]);
+                    if (cs->endingImages[i].id > 0) AssetCache_UnloadTexture(cs->endingImages[i]);
                 }
 
                 StopMusicStream(b2AudioManager.musicEnding);
@@ -86,7 +87,7 @@ void UpdateCutscene(CutsceneScene *cs, GameState *state, float deltaTime) {
     }
 
     // >>> LÓGICA DA INTRO <<<
-    if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_SPACE)) {
+    if (IsB2ButtonPressed(input, B2_BUTTON_CONFIRM) || IsB2ButtonPressed(input, B2_BUTTON_FIRE)) {
         *state = STATE_SHOP;
         return;
     }
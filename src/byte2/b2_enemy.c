@@ -1,8 +1,10 @@
 #include "b2_enemy.h"
 #include "raylib.h"
+#include "b2_atlas.h"
 #include "raymath.h"
 #include "b2_audio.h"
 #include "b2_bullet.h"
+#include "b2_rng.h"
 #include <stdio.h>
 #include <math.h>
 #include <stdbool.h>
@@ -23,50 +25,16 @@
 // NOVA CONSTANTE PARA CONTROLE DA DESCIDA DO BOSS (SUGERIDO: Mova para enemy.h)
 #define BOSS_DROP_AMOUNT 30.0f
 
-// Array de caminhos para os frames do Boss (corrigido para caminhos relativos)
-static const char *bossFramePaths[BOSS_FRAME_COUNT] = {
-    "assets/byte2/images/sprites/frame_04_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_05_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_06_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_07_delay-008s.gif",
-    "assets/byte2/images/sprites/frame_08_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_09_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_10_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_11_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_12_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_13_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_14_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_15_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_16_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_17_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_18_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_19_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_20_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_21_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_22_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_23_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_24_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_25_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_26_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_27_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_28_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_00_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_01_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_02_delay-0.08s.gif",
-    "assets/byte2/images/sprites/frame_03_delay-0.08s.gif",
-};
-
 // --- Funções de Partículas  ---
 
-void InitParticleManager(ParticleManager *manager) {
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        manager->particles[i].active = false;
-    }
-    manager->nextParticleIndex = 0;
-}
+// Explosões: sem gravidade, arrasto de 80%/s e quicando nas bordas da tela do jogo
+static const ParticleConfig EXPLOSION_PARTICLES = {
+    .gravity = 0.0f, .drag = 0.8f, .bounded = true, .bounds = { 0.0f, 0.0f, 800.0f, 600.0f },
+    .fadeSeconds = PARTICLE_LIFESPAN, .shape = PARTICLE_SHAPE_CIRCLE, .size = 3.0f
+};
 
 Color GetRandomNeonColor() {
-    int r = GetRandomValue(0, 5);
+    int r = GetB2RandomValue(0, 5);
     switch (r) {
         case 0: return RED;
         case 1: return COLOR_EXPLOSION_ORANGE;
@@ -79,125 +47,141 @@ Color GetRandomNeonColor() {
 }
 
 void ExplodeEnemy(EnemyManager *manager, Vector2 position, int particleCount) {
-    ParticleManager *pm = &manager->particleManager;
     for (int i = 0; i < particleCount; i++) {
-        Particle *p = &pm->particles[pm->nextParticleIndex];
+        float speed = (float)GetB2RandomValue(150, 400);
+        float angle = (float)GetB2RandomValue(0, 359);
+        Vector2 velocity = { cosf(angle * DEG2RAD) * speed, sinf(angle * DEG2RAD) * speed };
 
-        p->active = true;
-        p->position = position;
-        p->life = PARTICLE_LIFESPAN;
+        if (!ParticleSystem_Emit(&manager->particles, position, velocity, GetRandomNeonColor(), PARTICLE_LIFESPAN)) break;
+    }
+}
 
-        float speed = (float)GetRandomValue(150, 400);
-        float angle = (float)GetRandomValue(0, 359);
+// --- Funções de Inimigo Normal  ---
 
-        p->velocity.x = cosf(angle * DEG2RAD) * speed;
-        p->velocity.y = sinf(angle * DEG2RAD) * speed;
+// Meia largura da caixa que encosta na borda da tela (ENEMY_SIZE mais 5 px de margem de cada lado)
+#define ENEMY_BOUNDS_HALF_WIDTH (ENEMY_SIZE / 2.0f + 5.0f)
 
-        p->color = GetRandomNeonColor();
+// Tira o inimigo da formação: pool de vivos, máscara dos laços da marcha e grid
+static void KillEnemy(EnemyManager *manager, int id) {
+    EnemySlots_Release(&manager->alive, id);
+    manager->formation.live[id] = 0.0f;
+    RemoveB2GridItem(&manager->grid, id);
+}
 
-        pm->nextParticleIndex = (pm->nextParticleIndex + 1) % MAX_PARTICLES;
+// Aura neon: três anéis (externo e do meio na cor do inimigo, interno branco), em frações
+// do raio. Pré-renderizada uma vez por cor no atlas (GenEnemyAuraImage); por frame sobra
+// um quad do atlas por inimigo, no mesmo batch dos sprites
+#define AURA_RING_OUTER 0.85f
+#define AURA_RING_MIDDLE 0.75f
+#define AURA_RING_INNER 0.7f
+#define AURA_SUPERSAMPLE 4          // Amostras por eixo em cada pixel (borda antisserrilhada)
+#define AURA_PULSE_MIN_ALPHA 0.85f  // Transparência da aura no vale do pulso
+
+static Color NeonColorForType(int enemyType) {
+    switch (enemyType) {
+        case 3: return COLOR_NEON_RED;
+        case 2: return COLOR_NEON_PURPLE;
+        default: return COLOR_NEON_BLUE;
     }
 }
 
-void UpdateParticles(ParticleManager *manager, float deltaTime) {
-    const int GAME_WIDTH = 800;
-    const int GAME_HEIGHT = 600;
-
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        Particle *p = &manager->particles[i];
-        if (!p->active) continue;
-
-        p->life -= deltaTime;
-
-        if (p->life <= 0.0f) {
-            p->active = false;
-        } else {
-            p->position.x += p->velocity.x * deltaTime;
-            p->position.y += p->velocity.y * deltaTime;
+// Cor (alfa pré-multiplicado) dos anéis à distância d do centro, com d em frações do raio
+static Vector4 AuraSample(Color neon, float d) {
+    Color c;
+    float alpha;
+    if (d > 1.0f || d < AURA_RING_INNER) return (Vector4){ 0.0f, 0.0f, 0.0f, 0.0f };
+    if (d >= AURA_RING_OUTER) { c = neon; alpha = 0.2f; }
+    else if (d >= AURA_RING_MIDDLE) { c = neon; alpha = 0.4f; }
+    else { c = WHITE; alpha = 0.6f; }
+    return (Vector4){ c.r * alpha, c.g * alpha, c.b * alpha, alpha };
+}
 
-            if (p->position.x < 0 || p->position.x > GAME_WIDTH) {
-                p->velocity.x *= -1;
-                p->position.x = fmaxf(0, fminf(p->position.x, (float)GAME_WIDTH));
-            }
-            if (p->position.y < 0 || p->position.y > GAME_HEIGHT) {
-                p->velocity.y *= -1;
-                p->position.y = fmaxf(0, fminf(p->position.y, (float)GAME_HEIGHT));
+Image GenEnemyAuraImage(int enemyType, int size) {
+    Image image = GenImageColor(size, size, BLANK);
+    if (image.data == NULL) return image;
+
+    Color neon = NeonColorForType(enemyType);
+    unsigned char *pixels = (unsigned char *)image.data;
+    float radius = size * 0.5f;
+    const float step = 1.0f / AURA_SUPERSAMPLE;
+
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            Vector4 sum = { 0.0f, 0.0f, 0.0f, 0.0f };
+            for (int sy = 0; sy < AURA_SUPERSAMPLE; sy++) {
+                for (int sx = 0; sx < AURA_SUPERSAMPLE; sx++) {
+                    float dx = x + (sx + 0.5f) * step - radius;
+                    float dy = y + (sy + 0.5f) * step - radius;
+                    Vector4 s = AuraSample(neon, sqrtf(dx * dx + dy * dy) / radius);
+                    sum.x += s.x; sum.y += s.y; sum.z += s.z; sum.w += s.w;
+                }
             }
 
-            p->velocity = Vector2Scale(p->velocity, 1.0f - (0.8f * deltaTime));
+            // Média das amostras, de volta para alfa não pré-multiplicado
+            float alpha = sum.w * step * step;
+            unsigned char *p = pixels + ((size_t)y * size + x) * 4;
+            if (alpha <= 0.0f) continue;
+            p[0] = (unsigned char)fminf(255.0f, sum.x / sum.w + 0.5f);
+            p[1] = (unsigned char)fminf(255.0f, sum.y / sum.w + 0.5f);
+            p[2] = (unsigned char)fminf(255.0f, sum.z / sum.w + 0.5f);
+            p[3] = (unsigned char)(alpha * 255.0f + 0.5f);
         }
     }
+    return image;
 }
 
-void DrawParticles(ParticleManager *manager) {
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        Particle *p = &manager->particles[i];
-        if (!p->active) continue;
-
-        float alpha = p->life / PARTICLE_LIFESPAN;
-        Color drawColor = Fade(p->color, alpha);
-
-        DrawCircleV(p->position, 3.0f, drawColor);
+static B2SpriteId AuraSpriteForType(int enemyType) {
+    switch (enemyType) {
+        case 3: return B2_SPRITE_AURA_3;
+        case 2: return B2_SPRITE_AURA_2;
+        default: return B2_SPRITE_AURA_1;
     }
 }
 
-// --- Funções de Inimigo Normal  ---
-
-void DrawEnemy(Enemy *enemy, Texture2D texture) {
-    if (!enemy->active) return;
-
+// O pulso só muda a escala e a transparência do quad
+static void DrawEnemyAura(const EnemyFormation *formation, int id) {
     const float BASE_AURA_RADIUS = ENEMY_SIZE * 0.8f;
     float time = (float)GetTime();
     float pulse = (sinf(time * 6.0f) + 1.0f) * 0.5f;
     float currentRadius = BASE_AURA_RADIUS + (pulse * 2.0f);
 
-    Color outerColor = Fade(enemy->neonColor, 0.15f + (pulse * 0.05f));
-    DrawRing(enemy->position, currentRadius * 0.85f, currentRadius * 1.0f, 0, 360, 30, outerColor);
-
-    Color middleColor = Fade(enemy->neonColor, 0.4f);
-    DrawRing(enemy->position, currentRadius * 0.75f, currentRadius * 0.85f, 0, 360, 30, middleColor);
-
-    Color innerColor = Fade(WHITE, 0.6f);
-    DrawRing(enemy->position, currentRadius * 0.7f, currentRadius * 0.75f, 0, 360, 30, innerColor);
+    Rectangle destRec = { formation->x[id] - currentRadius, formation->y[id] - currentRadius, currentRadius * 2.0f, currentRadius * 2.0f };
+    float alpha = AURA_PULSE_MIN_ALPHA + (1.0f - AURA_PULSE_MIN_ALPHA) * pulse;
+    DrawB2Sprite(AuraSpriteForType(formation->type[id]), destRec, (Vector2){ 0.0f, 0.0f }, 0.0f, Fade(WHITE, alpha));
+}
 
+static void DrawEnemySprite(const EnemyFormation *formation, int id, B2SpriteId sprite) {
     float w = ENEMY_SIZE;
     float h = ENEMY_SIZE;
 
-    Rectangle destRec = { enemy->position.x - w / 2, enemy->position.y - h / 2, w, h };
+    Rectangle destRec = { formation->x[id] - w / 2, formation->y[id] - h / 2, w, h };
     Vector2 origin = { 0.0f, 0.0f };
 
     Color tintColor = WHITE;
-    if (enemy->hitTimer > 0.0f) {
+    if (formation->hitTimer[id] > 0.0f) {
         tintColor = RED;
     }
 
-    DrawTexturePro(
-        texture,
-        (Rectangle){ 0.0f, 0.0f, (float)texture.width, (float)texture.height },
-        destRec,
-        origin,
-        0.0f,
-        tintColor
-    );
+    DrawB2Sprite(sprite, destRec, origin, 0.0f, tintColor);
 }
 
-void DrawExplosion(Enemy *enemy) {
-    float progress = 1.0f - (enemy->explosionTimer / ENEMY_EXPLOSION_DURATION);
+static void DrawExplosion(const EnemyFormation *formation, int id) {
+    float progress = 1.0f - (formation->explosionTimer[id] / ENEMY_EXPLOSION_DURATION);
     float maxRadius = ENEMY_SIZE * 1.5f;
     float currentRadius = maxRadius * progress;
 
     Color outerColor = Fade(COLOR_EXPLOSION_ORANGE, 1.0f - progress);
     DrawCircle(
-        (int)enemy->position.x,
-        (int)enemy->position.y,
+        (int)formation->x[id],
+        (int)formation->y[id],
         currentRadius,
         outerColor
     );
 
     Color centerColor = Fade(YELLOW, 1.0f - progress * 0.5f);
     DrawCircle(
-        (int)enemy->position.x,
-        (int)enemy->position.y,
+        (int)formation->x[id],
+        (int)formation->y[id],
         currentRadius * 0.6f,
         centerColor
     );
@@ -279,11 +263,7 @@ void UpdateBoss(Boss *boss, float deltaTime, int screenWidth) {
     boss->rect.y = boss->position.y - boss->rect.height / 2.0f;
 }
 
-void DrawBoss(Boss *boss, Texture2D frames[]) {
-    if (!boss->active) return;
-
-    Texture2D currentTexture = frames[boss->currentFrame];
-
+static void DrawBossSprite(Boss *boss) {
     float w = BOSS_SIZE_WIDTH;
     float h = BOSS_SIZE_HEIGHT;
 
@@ -296,14 +276,12 @@ void DrawBoss(Boss *boss, Texture2D frames[]) {
         tintColor = RED;
     }
 
-    DrawTexturePro(
-        currentTexture,
-        (Rectangle){ 0.0f, 0.0f, (float)currentTexture.width, (float)currentTexture.height },
-        destRec,
-        origin,
-        0.0f,
-        tintColor
-    );
+    DrawB2Sprite((B2SpriteId)(B2_SPRITE_BOSS_FRAME_0 + boss->currentFrame), destRec, origin, 0.0f, tintColor);
+}
+
+static void DrawBossHealthBar(Boss *boss) {
+    float w = BOSS_SIZE_WIDTH;
+    float h = BOSS_SIZE_HEIGHT;
 
     // Desenhar barra de vida do Boss
     float barWidth = w * 1.5f;
@@ -327,6 +305,13 @@ void DrawBoss(Boss *boss, Texture2D frames[]) {
     );
 }
 
+void DrawBoss(Boss *boss) {
+    if (!boss->active) return;
+
+    DrawBossSprite(boss);
+    DrawBossHealthBar(boss);
+}
+
 // --- Lógica de Inicialização da Onda (Mantida) ---
 
 void InitEnemiesForWave(EnemyManager *manager, int screenWidth, int screenHeight, int waveNumber) {
@@ -345,7 +330,6 @@ void InitEnemiesForWave(EnemyManager *manager, int screenWidth, int screenHeight
     float speedMultiplier = 1.0f + (waveNumber - 1) * 0.15f;
     int healthBoost = (waveNumber - 1) / 3;
     float startY = 20.0f;
-    int enemiesToActivate = ENEMY_COUNT;
     int offsetRows = 0;
 
     if (waveNumber >= 10) {
@@ -359,7 +343,6 @@ void InitEnemiesForWave(EnemyManager *manager, int screenWidth, int screenHeight
         startY = 200.0f;
 
         // REMOVER PRIMEIRA LINHA (Linha 0)
-        enemiesToActivate = ENEMY_COUNT - ENEMY_COLS;
         offsetRows = 1;
     } else {
         // Waves normais (antes da 10)
@@ -370,22 +353,30 @@ void InitEnemiesForWave(EnemyManager *manager, int screenWidth, int screenHeight
     float startX = (screenWidth - totalWidth) / 2.0f;
 
     manager->direction = 1;
-    manager->activeCount = enemiesToActivate;
     manager->gameOver = false;
     manager->gameHeight = screenHeight;
 
-    const float COLLISION_MARGIN = 5.0f;
-    const float COLLISION_DIMENSION = ENEMY_SIZE + COLLISION_MARGIN * 2;
+    EnemyFormation *formation = &manager->formation;
+    ClearB2Grid(&manager->grid);
+    EnemySlots_Clear(&manager->alive);
+    EnemySlots_Clear(&manager->exploding);
+    for (int i = 0; i < ENEMY_CAPACITY; i++) {
+        // Todos começam mortos (inclusive o enchimento além de ENEMY_COUNT)
+        formation->live[i] = 0.0f;
+        formation->health[i] = 0;
+        formation->hitTimer[i] = 0.0f;
+        formation->explosionTimer[i] = 0.0f;
+        formation->type[i] = 1;
+        formation->x[i] = 0.0f;
+        formation->y[i] = 0.0f;
+    }
 
     for (int i = 0; i < ENEMY_COUNT; i++) {
-        Enemy *enemy = &manager->enemies[i];
         int row = i / ENEMY_COLS;
         int col = i % ENEMY_COLS;
 
         // Lógica para desativar a primeira linha na wave do Boss
         if (waveNumber >= 10 && row == 0) {
-            enemy->active = false;
-            enemy->health = 0;
             continue;
         }
 
@@ -396,45 +387,29 @@ void InitEnemiesForWave(EnemyManager *manager, int screenWidth, int screenHeight
         // Posição y ajustada: a primeira linha visível usa startY
         float currentY = startY + effectiveRow * (ENEMY_SIZE + ENEMY_PADDING_Y) + ENEMY_SIZE / 2.0f;
 
-        enemy->position.x = startX + col * (ENEMY_SIZE + ENEMY_PADDING_X) + ENEMY_SIZE / 2.0f;
-        enemy->position.y = currentY;
+        formation->x[i] = startX + col * (ENEMY_SIZE + ENEMY_PADDING_X) + ENEMY_SIZE / 2.0f;
+        formation->y[i] = currentY;
 
-        enemy->rect.width = COLLISION_DIMENSION;
-        enemy->rect.height = COLLISION_DIMENSION;
-        enemy->rect.x = enemy->position.x - COLLISION_DIMENSION / 2.0f;
-        enemy->rect.y = enemy->position.y - COLLISION_DIMENSION / 2.0f;
-
-        enemy->active = true;
-        enemy->hitTimer = 0.0f;
-        enemy->isExploding = false;
-        enemy->explosionTimer = 0.0f;
+        formation->live[i] = 1.0f;
+        EnemySlots_AcquireId(&manager->alive, i);
+        MoveB2GridItem(&manager->grid, i, (Vector2){ formation->x[i], formation->y[i] });
 
         // Definição de tipo/saúde (usa a linha original para definir o tipo)
         if (row == 0) {
-            enemy->neonColor = COLOR_NEON_RED;
-            enemy->type = 3;
-            enemy->health = ENEMY_INITIAL_HEALTH_T3 + healthBoost;
+            formation->type[i] = 3;
+            formation->health[i] = ENEMY_INITIAL_HEALTH_T3 + healthBoost;
         } else if (row <= 2) {
-            enemy->neonColor = COLOR_NEON_PURPLE;
-            enemy->type = 2;
-            enemy->health = ENEMY_INITIAL_HEALTH_T2 + healthBoost;
+            formation->type[i] = 2;
+            formation->health[i] = ENEMY_INITIAL_HEALTH_T2 + healthBoost;
         } else {
-            enemy->neonColor = COLOR_NEON_BLUE;
-            enemy->type = 1;
-            enemy->health = ENEMY_INITIAL_HEALTH_T1 + healthBoost;
+            formation->type[i] = 1;
+            formation->health[i] = ENEMY_INITIAL_HEALTH_T1 + healthBoost;
         }
     }
 }
 
 void InitEnemyManager(EnemyManager *manager, int screenWidth, int screenHeight) {
-    manager->enemyTextures[0] = LoadTexture("assets/byte2/images/sprites/inimigo_1.png");
-    manager->enemyTextures[1] = LoadTexture("assets/byte2/images/sprites/inimigo_2.png");
-    manager->enemyTextures[2] = LoadTexture("assets/byte2/images/sprites/inimigo_3.png");
-
-    // Carregamento dos Frames do Boss
-    for (int i = 0; i < BOSS_FRAME_COUNT; i++) {
-        manager->bossFrames[i] = LoadTexture(bossFramePaths[i]);
-    }
+    // Sprites dos inimigos e frames do Boss vêm do atlas (b2_atlas.c), criado no ByteSpace_Init
 
     manager->currentWave = 1;
     manager->waveStartTimer = WAVE_START_DURATION;
@@ -445,14 +420,20 @@ void InitEnemyManager(EnemyManager *manager, int screenWidth, int screenHeight)
 
     manager->bossActive = false;
 
-    InitParticleManager(&manager->particleManager);
+    // Reinício da partida reaproveita o bloco já alocado
+    if (manager->particles.capacity == 0) ParticleSystem_Init(&manager->particles, MAX_PARTICLES, EXPLOSION_PARTICLES);
+    ParticleSystem_Clear(&manager->particles);
+    if (manager->grid.capacity == 0) {
+        Rectangle area = { 0.0f, 0.0f, (float)screenWidth, (float)screenHeight };
+        InitB2Grid(&manager->grid, area, ENEMY_GRID_CELL_SIZE, ENEMY_COUNT, ENEMY_SIZE / 2.0f);
+    }
 
     InitEnemiesForWave(manager, screenWidth, screenHeight, manager->currentWave);
 }
 
 void CheckWaveCompletion(EnemyManager *manager, int screenWidth, int screenHeight) {
     // A onda termina se o Boss for derrotado E/OU se os inimigos normais acabarem.
-    if (!manager->bossActive && manager->activeCount == 0) {
+    if (!manager->bossActive && manager->alive.count == 0) {
         manager->wavesCompletedCount++;
         if (manager->wavesCompletedCount % 3 == 0) {
             manager->triggerShopReturn = true;
@@ -466,12 +447,15 @@ void CheckWaveCompletion(EnemyManager *manager, int screenWidth, int screenHeigh
 
 // --- Lógica de Atualização ---
 
+void UpdateExplosions(EnemyManager *manager, float deltaTime) {
+    ParticleSystem_Update(&manager->particles, deltaTime);
+}
+
 void UpdateEnemies(EnemyManager *manager, float deltaTime, int screenWidth, int *playerLives, bool *gameOver) {
     int screenHeight = manager->gameHeight;
 
     if (manager->waveStartTimer > 0.0f) {
         manager->waveStartTimer -= deltaTime;
-        UpdateParticles(&manager->particleManager, deltaTime);
         if (manager->waveStartTimer > 0.0f) {
              return;
         }
@@ -482,17 +466,13 @@ void UpdateEnemies(EnemyManager *manager, float deltaTime, int screenWidth, int
     }
 
     if (manager->triggerShopReturn || manager->waveStartTimer > 0.0f) {
-        UpdateParticles(&manager->particleManager, deltaTime);
         return;
     }
 
     if (manager->gameOver) {
-        UpdateParticles(&manager->particleManager, deltaTime);
         return;
     }
 
-    UpdateParticles(&manager->particleManager, deltaTime);
-
     // --- Lógica de Atualização do Boss ---
     if (manager->bossActive) {
         UpdateBoss(&manager->boss, deltaTime, screenWidth);
@@ -515,81 +495,72 @@ void UpdateEnemies(EnemyManager *manager, float deltaTime, int screenWidth, int
     }
 
     // --- Lógica de Atualização dos Inimigos Normais ---
+    EnemyFormation *formation = &manager->formation;
     float moveAmount = manager->speed * manager->direction * deltaTime;
     bool shouldDrop = false;
 
-    float minX = (float)screenWidth;
-    float maxX = 0.0f;
-
-    for (int i = 0; i < ENEMY_COUNT; i++) {
-        Enemy *enemy = &manager->enemies[i];
-
-        if (enemy->hitTimer > 0.0f) {
-            enemy->hitTimer -= deltaTime;
-        }
-
-        if (enemy->isExploding) {
-            enemy->explosionTimer -= deltaTime;
-
-            if (enemy->explosionTimer <= 0.0f) {
-                enemy->isExploding = false;
-            }
+    // Explosões em andamento; a que termina volta ao pool (e o k não avança)
+    for (int k = 0; k < manager->exploding.count; ) {
+        int id = manager->exploding.dense[k];
+        formation->explosionTimer[id] -= deltaTime;
+        if (formation->explosionTimer[id] <= 0.0f) {
+            EnemySlots_Release(&manager->exploding, id);
+        } else {
+            k++;
         }
+    }
 
-        if (!enemy->active && !enemy->isExploding) continue;
+    TickB2FormationTimers(formation->hitTimer, ENEMY_CAPACITY, deltaTime);
 
-        if (enemy->active) {
-            minX = fminf(minX, enemy->rect.x);
-            maxX = fmaxf(maxX, enemy->rect.x + enemy->rect.width);
-        }
-    }
+    // Borda da formação: o menor/maior centro entre os vivos mais a meia caixa de colisão
+    float minX, maxX;
+    MeasureB2Formation(formation->x, formation->live, ENEMY_CAPACITY, &minX, &maxX);
+    minX -= ENEMY_BOUNDS_HALF_WIDTH;
+    maxX += ENEMY_BOUNDS_HALF_WIDTH;
 
     const float margin = 2.0f;
 
-    if (manager->direction == 1) {
-        if (maxX >= screenWidth - margin) {
-            shouldDrop = true;
-        }
-    } else {
-        if (minX <= margin) {
-            shouldDrop = true;
+    if (manager->alive.count > 0) {
+        if (manager->direction == 1) {
+            if (maxX >= screenWidth - margin) {
+                shouldDrop = true;
+            }
+        } else {
+            if (minX <= margin) {
+                shouldDrop = true;
+            }
         }
     }
 
-    for (int i = 0; i < ENEMY_COUNT; i++) {
-        Enemy *enemy = &manager->enemies[i];
-        if (!enemy->active) continue;
-
-        enemy->position.x += moveAmount;
-        enemy->rect.x = enemy->position.x - enemy->rect.width / 2.0f;
-    }
+    ShiftB2Formation(formation->x, formation->live, ENEMY_CAPACITY, moveAmount);
 
     if (shouldDrop) {
         manager->direction *= -1;
         manager->speed *= 1.02f;
+        ShiftB2Formation(formation->y, formation->live, ENEMY_CAPACITY, ENEMY_DROP_AMOUNT);
+    }
 
-        for (int i = 0; i < ENEMY_COUNT; i++) {
-            Enemy *enemy = &manager->enemies[i];
-            if (!enemy->active) continue;
-
-            enemy->position.y += ENEMY_DROP_AMOUNT;
-            enemy->rect.y = enemy->position.y - enemy->rect.height / 2.0f;
+    // Linha de Game Over: só os vivos. Quem cruza a linha sai do pool (o último vivo vem para
+    // a posição k). O grid não acompanha a marcha aqui: o CheckBulletEnemyCollision o põe em
+    // dia quando for usá-lo
+    for (int k = 0; k < manager->alive.count; ) {
+        int id = manager->alive.dense[k];
 
-            if (enemy->position.y >= ENEMY_GAME_OVER_LINE_Y) {
+        if (formation->y[id] < ENEMY_GAME_OVER_LINE_Y) {
+            k++;
+            continue;
+        }
 
-                enemy->active = false;
-                manager->activeCount--;
+        KillEnemy(manager, id);
 
-                if (*playerLives > 0) {
-                    (*playerLives)--;
-                }
+        if (*playerLives > 0) {
+            (*playerLives)--;
+        }
 
-                if (*playerLives <= 0) {
-                    *playerLives = 0;
-                    manager->gameOver = true;
-                    (*gameOver) = true;
-                }
-            }
+        if (*playerLives <= 0) {
+            *playerLives = 0;
+            manager->gameOver = true;
+            (*gameOver) = true;
         }
     }
 }
@@ -597,53 +568,59 @@ void UpdateEnemies(EnemyManager *manager, float deltaTime, int screenWidth, int
 // --- Funções de Desenho e Colisão  ---
 
 void DrawEnemies(EnemyManager *manager) {
-    DrawParticles(&manager->particleManager);
+    ParticleSystem_Draw(&manager->particles);
 
-    // Desenha o Boss se estiver ativo
-    if (manager->bossActive) {
-        DrawBoss(&manager->boss, manager->bossFrames);
+    // 1. Formas: explosões dos inimigos normais
+    const EnemyFormation *formation = &manager->formation;
+    for (int k = 0; k < manager->exploding.count; k++) {
+        DrawExplosion(formation, manager->exploding.dense[k]);
     }
 
-    // Desenha inimigos normais
-    for (int i = 0; i < ENEMY_COUNT; i++) {
-        Enemy *enemy = &manager->enemies[i];
-
-        if (enemy->isExploding) {
-            DrawExplosion(enemy);
-
-        } else if (enemy->active) {
-            Texture2D texture;
-            switch (enemy->type) {
-                case 1: texture = manager->enemyTextures[0]; break;
-                case 2: texture = manager->enemyTextures[1]; break;
-                case 3: texture = manager->enemyTextures[2]; break;
-                default: texture = manager->enemyTextures[0]; break;
-            }
-            DrawEnemy(enemy, texture);
-        }
+    // 2. Atlas num único batch: auras, Boss (se estiver ativo) e sprites dos inimigos normais
+    for (int k = 0; k < manager->alive.count; k++) {
+        DrawEnemyAura(formation, manager->alive.dense[k]);
     }
-}
 
-void UnloadEnemyManager(EnemyManager *manager) {
-    for (int i = 0; i < 3; i++) {
-        if (manager->enemyTextures[i].id != 0) UnloadTexture(manager->enemyTextures[i]);
+    bool drawBoss = manager->bossActive && manager->boss.active;
+    if (drawBoss) {
+        DrawBossSprite(&manager->boss);
     }
 
-    // Descarregar as texturas do Boss
-    for (int i = 0; i < BOSS_FRAME_COUNT; i++) {
-        if (manager->bossFrames[i].id != 0) UnloadTexture(manager->bossFrames[i]);
+    for (int k = 0; k < manager->alive.count; k++) {
+        int id = manager->alive.dense[k];
+
+        B2SpriteId sprite;
+        switch (formation->type[id]) {
+            case 1: sprite = B2_SPRITE_ENEMY_1; break;
+            case 2: sprite = B2_SPRITE_ENEMY_2; break;
+            case 3: sprite = B2_SPRITE_ENEMY_3; break;
+            default: sprite = B2_SPRITE_ENEMY_1; break;
+        }
+        DrawEnemySprite(formation, id, sprite);
+    }
+
+    // 3. Barra de vida do Boss por cima
+    if (drawBoss) {
+        DrawBossHealthBar(&manager->boss);
     }
 }
 
+void UnloadEnemyManager(EnemyManager *manager) {
+    // As texturas de inimigos e do Boss pertencem ao atlas (UnloadB2Atlas)
+    ParticleSystem_Unload(&manager->particles);
+    UnloadB2Grid(&manager->grid);
+}
+
 void CheckBulletEnemyCollision(BulletManager *bulletManager, EnemyManager *enemyManager, int *playerGold, AudioManager *audioManager) {
 
     // --- Lógica de Colisão do Boss  ---
+    BulletPool *bullets = &bulletManager->bullets;
     Boss *boss = &enemyManager->boss;
     if (enemyManager->bossActive && boss->active) {
-        for (int i = 0; i < MAX_PLAYER_BULLETS; i++) {
-            Bullet *bullet = &bulletManager->bullets[i];
-
-            if (!bullet->active) continue;
+        // Uma bala que acerta volta ao pool e a última viva ocupa a posição k: só avança sem acerto
+        for (int k = 0; k < bullets->ids.count; ) {
+            int id = bullets->ids.dense[k];
+            Bullet *bullet = &bullets->items[id];
 
             Vector2 bulletCenter = {
                 bullet->rect.x + bullet->rect.width / 2.0f,
@@ -654,105 +631,130 @@ void CheckBulletEnemyCollision(BulletManager *bulletManager, EnemyManager *enemy
             float bossRadius = BOSS_SIZE_WIDTH / 2.0f;
 
             // Colisão de Círculos para o Boss
-            if (CheckCollisionCircles(bulletCenter, bulletRadius, boss->position, bossRadius * 0.8f)) {
-
-                // Filtro: O Boss SÓ leva dano dos tiros de tipo 2 (Médio) e 3 (Forte).
-                if (bullet->type == 1 || bullet->type == 0 || bullet->type == 4) {
-                    // Bala destruída, mas Boss não leva dano
-                    bullet->active = false;
-                    PlaySound(audioManager->sfxWeak);
-                    continue;
-                }
+            if (!CheckCollisionCircles(bulletCenter, bulletRadius, boss->position, bossRadius * 0.8f)) {
+                k++;
+                continue;
+            }
 
-                // Aplica NOVO DANO
-                int damage = 0;
-                if (bullet->type == 2) {
-                    damage = 750; //  Dano Médio
-                } else if (bullet->type == 3) {
-                    damage = 1500; //  Dano Forte
-                }
+            // Filtro: O Boss SÓ leva dano dos tiros de tipo 2 (Médio) e 3 (Forte).
+            if (bullet->type == 1 || bullet->type == 0 || bullet->type == 4) {
+                // Bala destruída, mas Boss não leva dano
+                BulletPool_Release(bullets, id);
+                PlaySound(audioManager->sfxWeak);
+                continue;
+            }
+
+            // Aplica NOVO DANO
+            int damage = 0;
+            if (bullet->type == 2) {
+                damage = 750; //  Dano Médio
+            } else if (bullet->type == 3) {
+                damage = 1500; //  Dano Forte
+            }
 
-                if (damage > 0) {
-                    bullet->active = false;
+            if (damage > 0) {
+                BulletPool_Release(bullets, id);
 
-                    boss->health -= damage; // Aplica o dano
-                    boss->hitTimer = ENEMY_FLASH_DURATION; // Boss pisca em vermelho
-                    PlaySound(audioManager->sfxWeak);
+                boss->health -= damage; // Aplica o dano
+                boss->hitTimer = ENEMY_FLASH_DURATION; // Boss pisca em vermelho
+                PlaySound(audioManager->sfxWeak);
 
-                    if (boss->health <= 0) {
-                        boss->active = false;
-                        enemyManager->bossActive = false;
+                if (boss->health <= 0) {
+                    boss->active = false;
+                    enemyManager->bossActive = false;
 
-                        *playerGold += 100;
+                    *playerGold += 100;
 
-                        PlaySound(audioManager->sfxExplosionEnemy);
-                        ExplodeEnemy(enemyManager, boss->position, EXPLOSION_PARTICLE_COUNT * 5);
+                    PlaySound(audioManager->sfxExplosionEnemy);
+                    ExplodeEnemy(enemyManager, boss->position, EXPLOSION_PARTICLE_COUNT * 5);
 
-                        if (enemyManager->activeCount == 0) {
-                            enemyManager->wavesCompletedCount++;
-                            enemyManager->triggerShopReturn = true;
-                        }
+                    if (enemyManager->alive.count == 0) {
+                        enemyManager->wavesCompletedCount++;
+                        enemyManager->triggerShopReturn = true;
                     }
                 }
-                break;
             }
+            break;
         }
     }
 
     // --- Lógica de Colisão de Inimigos Normais  ---
-    for (int i = 0; i < MAX_PLAYER_BULLETS; i++) {
-        Bullet *bullet = &bulletManager->bullets[i];
+    // Broadphase só quando compensa: com poucos pares (a onda do jogo, ~20 tiros x 55 inimigos)
+    // o grid sai ~30% mais caro que o laço direto (b2_grid_bench), então abaixo de
+    // ENEMY_GRID_MIN_PAIRS cada tiro passa pelos vivos e o grid nem é atualizado
+    EnemyFormation *formation = &enemyManager->formation;
+    bool useGrid = bullets->ids.count * enemyManager->alive.count >= ENEMY_GRID_MIN_PAIRS;
+    if (useGrid) {
+        for (int k = 0; k < enemyManager->alive.count; k++) {
+            int id = enemyManager->alive.dense[k];
+            MoveB2GridItem(&enemyManager->grid, id, (Vector2){ formation->x[id], formation->y[id] });
+        }
+    }
 
-        if (!bullet->active) continue;
+    for (int k = 0; k < bullets->ids.count; ) {
+        int id = bullets->ids.dense[k];
+        Bullet *bullet = &bullets->items[id];
 
         Vector2 bulletCenter = {
             bullet->rect.x + bullet->rect.width / 2.0f,
             bullet->rect.y + bullet->rect.height / 2.0f
         };
         float bulletRadius = bullet->rect.width / 2.0f;
+        float enemyRadius = ENEMY_SIZE / 2.0f;
+
+        // Grid: só os inimigos das células ao alcance do tiro; senão, todos os vivos. Entre os
+        // que encostam, vale o de menor índice (a mesma ordem do antigo laço sobre todos)
+        int hitIndex = -1;
+        if (useGrid) {
+            int candidates[ENEMY_COUNT];
+            int candidateCount = QueryB2Grid(&enemyManager->grid, bulletCenter, bulletRadius, candidates, ENEMY_COUNT);
+            for (int c = 0; c < candidateCount; c++) {
+                int j = candidates[c];
+                if (!EnemySlots_IsLive(&enemyManager->alive, j)) continue;
+                if (hitIndex >= 0 && j > hitIndex) continue;
+                if (CheckCollisionCircles(bulletCenter, bulletRadius, (Vector2){ formation->x[j], formation->y[j] }, enemyRadius)) hitIndex = j;
+            }
+        } else {
+            for (int a = 0; a < enemyManager->alive.count; a++) {
+                int j = enemyManager->alive.dense[a];
+                if (hitIndex >= 0 && j > hitIndex) continue;
+                if (CheckCollisionCircles(bulletCenter, bulletRadius, (Vector2){ formation->x[j], formation->y[j] }, enemyRadius)) hitIndex = j;
+            }
+        }
 
-        for (int j = 0; j < ENEMY_COUNT; j++) {
-            Enemy *enemy = &enemyManager->enemies[j];
-
-            if (!enemy->active || enemy->isExploding) continue;
-
-            float enemyRadius = ENEMY_SIZE / 2.0f;
-
-            if (CheckCollisionCircles(bulletCenter, bulletRadius, enemy->position, enemyRadius)) {
-
-                bullet->active = false;
-
-                // Dano para inimigos normais
-                int damage = 1;
-                if (bullet->type == 2) damage = 2;
-                if (bullet->type == 3) damage = 4;
-
-                enemy->health -= damage;
-                enemy->hitTimer = ENEMY_FLASH_DURATION;
+        if (hitIndex < 0) {
+            k++;
+            continue;
+        }
+        int bulletType = bullet->type;
+        BulletPool_Release(bullets, id);
 
-                if (enemy->health <= 0) {
-                    enemy->active = false;
-                    enemy->isExploding = true;
-                    enemy->explosionTimer = ENEMY_EXPLOSION_DURATION;
-                    enemyManager->activeCount--;
+        // Dano para inimigos normais
+        int damage = 1;
+        if (bulletType == 2) damage = 2;
+        if (bulletType == 3) damage = 4;
 
-                    *playerGold += 2 + (enemy->type * 2);
+        formation->health[hitIndex] -= damage;
+        formation->hitTimer[hitIndex] = ENEMY_FLASH_DURATION;
 
-                    PlaySound(audioManager->sfxExplosionEnemy);
+        if (formation->health[hitIndex] <= 0) {
+            KillEnemy(enemyManager, hitIndex);
+            EnemySlots_AcquireId(&enemyManager->exploding, hitIndex);
+            formation->explosionTimer[hitIndex] = ENEMY_EXPLOSION_DURATION;
 
-                    ExplodeEnemy(enemyManager, enemy->position, EXPLOSION_PARTICLE_COUNT);
+            *playerGold += 2 + (formation->type[hitIndex] * 2);
 
-                    if (!enemyManager->bossActive && enemyManager->activeCount == 0) {
-                         enemyManager->wavesCompletedCount++;
-                         enemyManager->triggerShopReturn = true;
-                    }
+            PlaySound(audioManager->sfxExplosionEnemy);
 
-                } else {
-                    PlaySound(audioManager->sfxWeak);
-                }
+            ExplodeEnemy(enemyManager, (Vector2){ formation->x[hitIndex], formation->y[hitIndex] }, EXPLOSION_PARTICLE_COUNT);
 
-                break;
+            if (!enemyManager->bossActive && enemyManager->alive.count == 0) {
+                 enemyManager->wavesCompletedCount++;
+                 enemyManager->triggerShopReturn = true;
             }
+
+        } else {
+            PlaySound(audioManager->sfxWeak);
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include "b2_formation.h"
+#include <float.h>
+#include <stdbool.h>
+
+// count já vem múltiplo de B2_FORMATION_LANES; a máscara só deixa isso visível para o
+// compilador, que sem ela não vetoriza no -O2 (laços que pediriam um resto escalar)
+static int Lanes(int count) {
+    return count & ~(B2_FORMATION_LANES - 1);
+}
+
+// --- BORDA ---
+// Uma redução min/max escrita direto (lo = x < lo ? x : lo) não vetoriza sem -ffast-math:
+// o compilador tem que respeitar NaN na ordem das comparações. Com B2_FORMATION_LANES
+// acumuladores independentes o laço interno vira um minps/maxps por bloco, e só os 8
+// acumuladores são reduzidos no fim
+void MeasureB2Formation(const float *restrict x, const float *restrict live, int count, float *minX, float *maxX) {
+    float lo[B2_FORMATION_LANES], hi[B2_FORMATION_LANES];
+    for (int l = 0; l < B2_FORMATION_LANES; l++) {
+        lo[l] = FLT_MAX;
+        hi[l] = -FLT_MAX;
+    }
+
+    int n = Lanes(count);
+    for (int b = 0; b < n; b += B2_FORMATION_LANES) {
+        for (int l = 0; l < B2_FORMATION_LANES; l++) {
+            float value = x[b + l];
+            bool alive = live[b + l] > 0.0f;
+            float low = alive ? value : FLT_MAX;
+            float high = alive ? value : -FLT_MAX;
+            lo[l] = (low < lo[l]) ? low : lo[l];
+            hi[l] = (high > hi[l]) ? high : hi[l];
+        }
+    }
+
+    float resultMin = lo[0], resultMax = hi[0];
+    for (int l = 1; l < B2_FORMATION_LANES; l++) {
+        if (lo[l] < resultMin) resultMin = lo[l];
+        if (hi[l] > resultMax) resultMax = hi[l];
+    }
+    *minX = resultMin;
+    *maxX = resultMax;
+}
+
+// --- PASSO ---
+// Multiplicar pela máscara em vez de testar: o morto soma 0 e o laço não tem desvio
+void ShiftB2Formation(float *restrict values, const float *restrict live, int count, float amount) {
+    int n = Lanes(count);
+    for (int i = 0; i < n; i++) values[i] += amount * live[i];
+}
+
+void TickB2FormationTimers(float *restrict timers, int count, float dt) {
+    int n = Lanes(count);
+    for (int i = 0; i < n; i++) {
+        float t = timers[i] - dt;
+        timers[i] = (t > 0.0f) ? t : 0.0f;
+    }
+}
@@ -0,0 +1,116 @@
+#include "b2_grid.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- AUXILIARES ---
+// Coluna/linha de uma coordenada, presa ao grid: itens e consultas fora de bounds usam as
+// células da borda (o recorte é monotônico, então nenhum par que se toca é perdido)
+static int CellCoord(float value, float origin, float invCellSize, int count) {
+    int c = (int)floorf((value - origin) * invCellSize);
+    if (c < 0) return 0;
+    if (c >= count) return count - 1;
+    return c;
+}
+
+static int CellIndex(const B2Grid *grid, Vector2 position) {
+    int cx = CellCoord(position.x, grid->bounds.x, grid->invCellSize, grid->cols);
+    int cy = CellCoord(position.y, grid->bounds.y, grid->invCellSize, grid->rows);
+    return cy * grid->cols + cx;
+}
+
+static void Unlink(B2Grid *grid, int id) {
+    int cell = grid->cellOf[id];
+    if (grid->prev[id] >= 0) grid->next[grid->prev[id]] = grid->next[id];
+    else grid->cellHead[cell] = grid->next[id];
+    if (grid->next[id] >= 0) grid->prev[grid->next[id]] = grid->prev[id];
+    grid->cellOf[id] = -1;
+}
+
+// --- MEMÓRIA ---
+bool InitB2Grid(B2Grid *grid, Rectangle bounds, float cellSize, int capacity, float maxRadius) {
+    memset(grid, 0, sizeof(*grid));
+    if (cellSize <= 0.0f || capacity <= 0) return false;
+
+    grid->bounds = bounds;
+    grid->cellSize = cellSize;
+    grid->invCellSize = 1.0f / cellSize;
+    grid->cols = (int)ceilf(bounds.width / cellSize);
+    grid->rows = (int)ceilf(bounds.height / cellSize);
+    if (grid->cols < 1) grid->cols = 1;
+    if (grid->rows < 1) grid->rows = 1;
+    grid->maxRadius = maxRadius;
+    grid->capacity = capacity;
+
+    int cellCount = grid->cols * grid->rows;
+    grid->cellHead = (int *)malloc((size_t)cellCount * sizeof(int));
+    grid->next = (int *)malloc((size_t)capacity * 3 * sizeof(int));
+    if (!grid->cellHead || !grid->next) {
+        printf("ERRO: Sem memoria para o grid (%dx%d celulas, %d itens).\n", grid->cols, grid->rows, capacity);
+        UnloadB2Grid(grid);
+        return false;
+    }
+    // Um bloco para os três arrays por item
+    grid->prev = grid->next + capacity;
+    grid->cellOf = grid->prev + capacity;
+
+    ClearB2Grid(grid);
+    return true;
+}
+
+void UnloadB2Grid(B2Grid *grid) {
+    free(grid->cellHead);
+    free(grid->next);
+    memset(grid, 0, sizeof(*grid));
+}
+
+void ClearB2Grid(B2Grid *grid) {
+    for (int c = 0; c < grid->cols * grid->rows; c++) grid->cellHead[c] = -1;
+    for (int i = 0; i < grid->capacity; i++) {
+        grid->next[i] = -1;
+        grid->prev[i] = -1;
+        grid->cellOf[i] = -1;
+    }
+}
+
+// --- ITENS ---
+void MoveB2GridItem(B2Grid *grid, int id, Vector2 position) {
+    if (id < 0 || id >= grid->capacity) return;
+
+    int cell = CellIndex(grid, position);
+    if (grid->cellOf[id] == cell) return; // Mesma célula: nada a religar
+    if (grid->cellOf[id] >= 0) Unlink(grid, id);
+
+    grid->prev[id] = -1;
+    grid->next[id] = grid->cellHead[cell];
+    if (grid->next[id] >= 0) grid->prev[grid->next[id]] = id;
+    grid->cellHead[cell] = id;
+    grid->cellOf[id] = cell;
+}
+
+void RemoveB2GridItem(B2Grid *grid, int id) {
+    if (id < 0 || id >= grid->capacity || grid->cellOf[id] < 0) return;
+    Unlink(grid, id);
+}
+
+// --- CONSULTA ---
+int QueryB2Grid(const B2Grid *grid, Vector2 center, float radius, int *out, int maxOut) {
+    if (grid->capacity == 0) return 0;
+    float reach = radius + grid->maxRadius;
+    int minX = CellCoord(center.x - reach, grid->bounds.x, grid->invCellSize, grid->cols);
+    int maxX = CellCoord(center.x + reach, grid->bounds.x, grid->invCellSize, grid->cols);
+    int minY = CellCoord(center.y - reach, grid->bounds.y, grid->invCellSize, grid->rows);
+    int maxY = CellCoord(center.y + reach, grid->bounds.y, grid->invCellSize, grid->rows);
+
+    int count = 0;
+    for (int cy = minY; cy <= maxY; cy++) {
+        for (int cx = minX; cx <= maxX; cx++) {
+            for (int id = grid->cellHead[cy * grid->cols + cx]; id >= 0; id = grid->next[id]) {
+                if (count >= maxOut) return count;
+                out[count++] = id;
+            }
+        }
+    }
+    return count;
+}
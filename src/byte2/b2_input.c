@@ -0,0 +1,27 @@
+#include "b2_input.h"
+#include "raylib.h"
+
+// Tecla de cada bit de B2Button, na mesma ordem
+static const int buttonKeys[] = {
+    KEY_LEFT, KEY_RIGHT, KEY_UP, KEY_DOWN, KEY_SPACE, KEY_E, KEY_F, KEY_P, KEY_Z, KEY_ENTER
+};
+#define BUTTON_COUNT (int)(sizeof(buttonKeys) / sizeof(buttonKeys[0]))
+
+uint16_t ReadB2Buttons(uint16_t *taps) {
+    uint16_t held = 0;
+    uint16_t tapped = 0;
+    for (int i = 0; i < BUTTON_COUNT; i++) {
+        if (IsKeyDown(buttonKeys[i])) held |= (uint16_t)(1u << i);
+        if (IsKeyPressed(buttonKeys[i])) tapped |= (uint16_t)(1u << i);
+    }
+    if (taps) *taps = tapped;
+    return held;
+}
+
+B2Input MakeB2Input(uint16_t previousHeld, uint16_t held) {
+    B2Input input;
+    input.held = held;
+    input.pressed = (uint16_t)(held & ~previousHeld);
+    input.released = (uint16_t)(previousHeld & ~held);
+    return input;
+}
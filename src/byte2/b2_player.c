@@ -1,5 +1,6 @@
 #include "b2_player.h"
 #include "raylib.h"
+#include "asset_cache.h"
 #include "raymath.h"
 #include "b2_audio.h"
 #include "b2_bullet.h"
@@ -48,15 +49,16 @@ int CalculateAttackType(float charge) {
 // --- FUNÇÃO DE INICIALIZAÇÃO DO JOGADOR ---
 void InitPlayer(Player *player) {
     // Carrega as diferentes texturas do jogador
-    player->baseTexture = LoadTexture(BASE_SPRITE_PATH);
-    player->shurikenTexture = LoadTexture(SHURIKEN_SPRITE_PATH);
-    player->shieldTextureAppearance = LoadTexture(SHIELD_SPRITE_PATH);
-    player->extraLifeTextureAppearance = LoadTexture(EXTRA_LIFE_SPRITE_PATH);
+    player->baseTexture = AssetCache_LoadTexture(BASE_SPRITE_PATH);
+    player->shurikenTexture = AssetCache_LoadTexture(SHURIKEN_SPRITE_PATH);
+    player->shieldTextureAppearance = AssetCache_LoadTexture(SHIELD_SPRITE_PATH);
+    player->extraLifeTextureAppearance = AssetCache_LoadTexture(EXTRA_LIFE_SPRITE_PATH);
 
     // Inicialmente, usa a textura base
     player->texture = player->baseTexture;
 
     player->scale = PLAYER_SCALE;
+    player->size = (Vector2){ PLAYER_SPRITE_WIDTH * PLAYER_SCALE, PLAYER_SPRITE_HEIGHT * PLAYER_SCALE };
     player->speed = PLAYER_MOVE_SPEED;
 
     player->gold = 0;
@@ -76,8 +78,8 @@ void InitPlayer(Player *player) {
     player->extraLives = 0;
 
     // Cálculo do tamanho escalado
-    float player_width_scaled = player->texture.width * player->scale;
-    float player_height_scaled = (float)player->texture.height * player->scale;
+    float player_width_scaled = player->size.x;
+    float player_height_scaled = player->size.y;
 
     // Posição inicial (no centro, próximo ao fundo)
     player->position = (Vector2){
@@ -99,17 +101,17 @@ void InitPlayer(Player *player) {
 }
 
 // --- FUNÇÃO DE ATUALIZAÇÃO DO JOGADOR ---
-void UpdatePlayer(Player *player, BulletManager *bulletManager, AudioManager *audioManager, Hud *hud, float deltaTime, int screenWidth, int screenHeight) {
+void UpdatePlayer(Player *player, BulletManager *bulletManager, AudioManager *audioManager, Hud *hud, const B2Input *input, float deltaTime, int screenWidth, int screenHeight) {
     float move_dist = player->speed * deltaTime;
 
     // --- MOVIMENTO ---
-    if (IsKeyDown(KEY_LEFT)) player->position.x -= move_dist;
-    if (IsKeyDown(KEY_RIGHT)) player->position.x += move_dist;
-    if (IsKeyDown(KEY_UP)) player->position.y -= move_dist;
-    if (IsKeyDown(KEY_DOWN)) player->position.y += move_dist;
+    if (IsB2ButtonDown(input, B2_BUTTON_LEFT)) player->position.x -= move_dist;
+    if (IsB2ButtonDown(input, B2_BUTTON_RIGHT)) player->position.x += move_dist;
+    if (IsB2ButtonDown(input, B2_BUTTON_UP)) player->position.y -= move_dist;
+    if (IsB2ButtonDown(input, B2_BUTTON_DOWN)) player->position.y += move_dist;
 
-    float ship_width = player->texture.width * player->scale;
-    float ship_height = player->texture.height * player->scale;
+    float ship_width = player->size.x;
+    float ship_height = player->size.y;
     Vector2 playerCenter = {
         player->position.x + ship_width / 2,
         player->position.y + ship_height / 2
@@ -118,7 +120,7 @@ void UpdatePlayer(Player *player, BulletManager *bulletManager, AudioManager *au
     // Apenas executa a lógica de tiro se os gerenciadores estiverem disponíveis
     if (audioManager != NULL && bulletManager != NULL) {
         // --- LÓGICA DE CARREGAMENTO (CHARGE) ---
-        if (IsKeyDown(KEY_SPACE)) {
+        if (IsB2ButtonDown(input, B2_BUTTON_FIRE)) {
             player->isCharging = true;
             // Aumenta a carga de energia (Clamped entre 0 e MAX_CHARGE)
             player->energyCharge = Clamp(player->energyCharge + CHARGE_RATE * deltaTime, 0.0f, MAX_CHARGE);
@@ -141,7 +143,7 @@ void UpdatePlayer(Player *player, BulletManager *bulletManager, AudioManager *au
 
         }
         // --- LÓGICA DE DISPARO (RELEASE) ---
-        else if (IsKeyReleased(KEY_SPACE) && player->energyCharge > 0.0f) {
+        else if (IsB2ButtonReleased(input, B2_BUTTON_FIRE) && player->energyCharge > 0.0f) {
             player->isCharging = false;
 
             // Determina o tipo de ataque com base na carga
@@ -159,13 +161,13 @@ void UpdatePlayer(Player *player, BulletManager *bulletManager, AudioManager *au
         }
 
         // --- LÓGICA DE NÃO-CARREGAMENTO (NOT PRESSING SPACE) ---
-        if (!IsKeyDown(KEY_SPACE)) {
+        if (!IsB2ButtonDown(input, B2_BUTTON_FIRE)) {
             // Se soltou a tecla, mas não tinha carga suficiente (ou já disparou), reseta
             player->isCharging = false;
             // Garante que o som de carga pare
             StopSound(audioManager->sfxCharge);
 
-            // Nota: Se a energia era > 0.0f, ela já foi resetada no 'IsKeyReleased'
+            // Nota: Se a energia era > 0.0f, ela já foi resetada no disparo acima
         }
     }
 
@@ -180,8 +182,8 @@ void UpdatePlayer(Player *player, BulletManager *bulletManager, AudioManager *au
 void DrawPlayer(Player *player) {
     if (player->texture.id == 0) return; // Não desenha se a textura não estiver carregada
 
-    float ship_width = player->texture.width * player->scale;
-    float ship_height = player->texture.height * player->scale;
+    float ship_width = player->size.x;
+    float ship_height = player->size.y;
     Vector2 playerCenter = {
         player->position.x + ship_width / 2,
         player->position.y + ship_height / 2
@@ -260,8 +262,8 @@ void DrawPlayer(Player *player) {
 // --- FUNÇÃO DE FINALIZAÇÃO ---
 // Descarrega todas as texturas da memória
 void UnloadPlayer(Player *player) {
-    if (player->baseTexture.id != 0) UnloadTexture(player->baseTexture);
-    if (player->shurikenTexture.id != 0) UnloadTexture(player->shurikenTexture);
-    if (player->shieldTextureAppearance.id != 0) UnloadTexture(player->shieldTextureAppearance);
-    if (player->extraLifeTextureAppearance.id != 0) UnloadTexture(player->extraLifeTextureAppearance);
+    if (player->baseTexture.id != 0) AssetCache_UnloadTexture(player->baseTexture);
+    if (player->shurikenTexture.id != 0) AssetCache_UnloadTexture(player->shurikenTexture);
+    if (player->shieldTextureAppearance.id != 0) AssetCache_UnloadTexture(player->shieldTextureAppearance);
+    if (player->extraLifeTextureAppearance.id != 0) AssetCache_UnloadTexture(player->extraLifeTextureAppearance);
 }
\ No newline at end of file
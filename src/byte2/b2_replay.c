@@ -0,0 +1,159 @@
+#include "b2_replay.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// O layout em disco depende destes tamanhos (header alinhado em 8)
+typedef char B2ReplayHeaderSizeCheck[(sizeof(B2ReplayHeader) == 32) ? 1 : -1];
+typedef char B2ReplayRunSizeCheck[(sizeof(B2ReplayRun) == 4) ? 1 : -1];
+
+#define INITIAL_RUN_CAPACITY 256
+
+// --- AUXILIARES ---
+static bool GrowRuns(B2Replay *replay, int minCapacity) {
+    if (replay->runCapacity >= minCapacity) return true;
+    int capacity = (replay->runCapacity > 0) ? replay->runCapacity : INITIAL_RUN_CAPACITY;
+    while (capacity < minCapacity) capacity *= 2;
+
+    B2ReplayRun *runs = (B2ReplayRun *)realloc(replay->runs, (size_t)capacity * sizeof(B2ReplayRun));
+    if (!runs) {
+        printf("ERRO: Sem memoria para o replay (%d corridas).\n", capacity);
+        return false;
+    }
+    replay->runs = runs;
+    replay->runCapacity = capacity;
+    return true;
+}
+
+uint64_t HashB2Bytes(uint64_t hash, const void *data, size_t size) {
+    const unsigned char *bytes = (const unsigned char *)data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ull; // FNV-1a 64
+    }
+    return hash;
+}
+
+// --- GRAVAÇÃO ---
+void BeginB2Recording(B2Replay *replay, uint32_t seed, uint32_t tickRate) {
+    UnloadB2Replay(replay);
+    replay->seed = seed;
+    replay->tickRate = tickRate;
+}
+
+void RecordB2Tick(B2Replay *replay, uint16_t buttons) {
+    if (replay->failed) return;
+    if (replay->runCount > 0) {
+        B2ReplayRun *last = &replay->runs[replay->runCount - 1];
+        if (last->buttons == buttons && last->length < UINT16_MAX) {
+            last->length++;
+            replay->tickCount++;
+            return;
+        }
+    }
+    // Um tick perdido trocaria a sequência de botões: a gravação inteira deixa de valer
+    if (!GrowRuns(replay, replay->runCount + 1)) {
+        replay->failed = true;
+        return;
+    }
+    replay->runs[replay->runCount++] = (B2ReplayRun){ buttons, 1 };
+    replay->tickCount++;
+}
+
+bool SaveB2Replay(const B2Replay *replay, const char *path) {
+    B2ReplayHeader header = { 0 };
+    memcpy(header.magic, B2_REPLAY_MAGIC, 4);
+    header.version = B2_REPLAY_VERSION;
+    header.tickRate = replay->tickRate;
+    header.seed = replay->seed;
+    header.tickCount = replay->tickCount;
+    header.runCount = (uint32_t)replay->runCount;
+    header.finalHash = replay->finalHash;
+
+    // Grava num temporário e renomeia: uma escrita interrompida não deixa um .b2r pela metade
+    char tempPath[512];
+    snprintf(tempPath, sizeof(tempPath), "%s.tmp", path);
+
+    FILE *f = fopen(tempPath, "wb");
+    if (!f) {
+        printf("AVISO: Nao foi possivel gravar o replay %s.\n", path);
+        return false;
+    }
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1;
+    if (ok && replay->runCount > 0) ok = fwrite(replay->runs, sizeof(B2ReplayRun), (size_t)replay->runCount, f) == (size_t)replay->runCount;
+    ok = (fclose(f) == 0) && ok;
+
+    remove(path); // rename() no Windows falha se o destino existir
+    if (!ok || rename(tempPath, path) != 0) {
+        remove(tempPath);
+        printf("AVISO: Nao foi possivel gravar o replay %s.\n", path);
+        return false;
+    }
+    return true;
+}
+
+// --- LEITURA ---
+bool LoadB2Replay(B2Replay *replay, const char *path) {
+    UnloadB2Replay(replay);
+
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        printf("ERRO: Replay %s nao encontrado.\n", path);
+        return false;
+    }
+
+    B2ReplayHeader header;
+    bool ok = fread(&header, sizeof(header), 1, f) == 1 &&
+              memcmp(header.magic, B2_REPLAY_MAGIC, 4) == 0 &&
+              header.version == B2_REPLAY_VERSION &&
+              header.tickRate > 0 &&
+              header.runCount <= (uint32_t)(INT32_MAX / sizeof(B2ReplayRun));
+
+    if (ok && header.runCount > 0) {
+        ok = GrowRuns(replay, (int)header.runCount) &&
+             fread(replay->runs, sizeof(B2ReplayRun), header.runCount, f) == header.runCount;
+    }
+    fclose(f);
+
+    // As corridas têm que somar exatamente tickCount
+    uint64_t total = 0;
+    for (uint32_t i = 0; ok && i < header.runCount; i++) {
+        if (replay->runs[i].length == 0) ok = false;
+        total += replay->runs[i].length;
+    }
+    if (!ok || total != header.tickCount) {
+        printf("ERRO: Replay %s invalido.\n", path);
+        UnloadB2Replay(replay);
+        return false;
+    }
+
+    replay->tickRate = header.tickRate;
+    replay->seed = header.seed;
+    replay->tickCount = header.tickCount;
+    replay->finalHash = header.finalHash;
+    replay->runCount = (int)header.runCount;
+    RewindB2Replay(replay);
+    return true;
+}
+
+void RewindB2Replay(B2Replay *replay) {
+    replay->cursorRun = 0;
+    replay->cursorTick = 0;
+}
+
+bool NextB2ReplayTick(B2Replay *replay, uint16_t *buttons) {
+    if (replay->cursorRun >= replay->runCount) return false;
+
+    const B2ReplayRun *run = &replay->runs[replay->cursorRun];
+    *buttons = run->buttons;
+    if (++replay->cursorTick >= run->length) {
+        replay->cursorRun++;
+        replay->cursorTick = 0;
+    }
+    return true;
+}
+
+void UnloadB2Replay(B2Replay *replay) {
+    free(replay->runs);
+    memset(replay, 0, sizeof(*replay));
+}
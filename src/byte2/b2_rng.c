@@ -0,0 +1,40 @@
+#include "b2_rng.h"
+
+// PCG32 (O'Neill): 64 bits de estado, saída de 32 bits, rápido e com boa distribuição
+#define PCG_MULTIPLIER 6364136223846793005ULL
+#define PCG_INCREMENT 1442695040888963407ULL
+
+static uint64_t rngState = 0;
+static uint32_t rngSeed = 0;
+
+static uint32_t NextB2Random(void) {
+    uint64_t old = rngState;
+    rngState = old * PCG_MULTIPLIER + PCG_INCREMENT;
+    uint32_t xorshifted = (uint32_t)(((old >> 18u) ^ old) >> 27u);
+    uint32_t rot = (uint32_t)(old >> 59u);
+    return (xorshifted >> rot) | (xorshifted << ((32u - rot) & 31u));
+}
+
+void SeedB2Rng(uint32_t seed) {
+    rngSeed = seed;
+    rngState = 0;
+    NextB2Random();
+    rngState += seed;
+    NextB2Random();
+}
+
+uint32_t GetB2RngSeed(void) {
+    return rngSeed;
+}
+
+int GetB2RandomValue(int min, int max) {
+    if (min > max) {
+        int tmp = max;
+        max = min;
+        min = tmp;
+    }
+    // Multiplica em vez de usar módulo: leva 32 bits ao intervalo sem o viés dos bits baixos
+    uint32_t range = (uint32_t)((int64_t)max - min) + 1u;
+    if (range == 0u) return (int)NextB2Random(); // [INT_MIN, INT_MAX]
+    return min + (int)(((uint64_t)NextB2Random() * range) >> 32);
+}
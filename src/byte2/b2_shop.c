@@ -1,6 +1,7 @@
 #include "b2_shop.h"
 #include "b2_player.h"
 #include "raylib.h"
+#include "b2_atlas.h"
 #include <stdio.h>
 #include <math.h>
 
@@ -19,10 +20,7 @@
 #define HORIZON_OFFSET_Y -50.0f // Deslocamento do horizonte verticalmente a partir do meio da tela
 #define PARTICLE_LIFETIME 0.5f // Duração do efeito de partículas após a compra
 
-// Caminhos das texturas dos itens (Power-ups)
-#define ENERGY_POWERUP_PATH "assets/byte2/images/sprites/energy_icon.png"
-#define SHURIKEN_PATH "assets/byte2/images/sprites/icone_powerup_shurikens.png"
-#define SHIELD_PATH "assets/byte2/images/sprites/shield.png"
+// Os ícones dos itens (Power-ups) ficam no atlas do Byte Space (b2_atlas.c)
 // #define EXTRA_LIFE_PATH "assets/images/sprites/vidaextra.png" // REMOVIDO
 
 // Constantes para a caixa de diálogo na parte inferior
@@ -68,23 +66,18 @@ void InitShop(ShopScene *shop, Player *player, int gameWidth, int gameHeight) {
     };
 
     // Posicionamento inicial do Player na loja (longe da caixa de diálogo)
-    float playerH = player->texture.height * player->scale;
-    float playerW = player->texture.width * player->scale;
+    float playerH = player->size.y;
+    float playerW = player->size.x;
     player->position = (Vector2){
         (float)gameWidth / 2 - playerW / 2,
         600.0f - TEXT_BOX_HEIGHT - playerH - 10.0f // Posicionado acima da caixa de diálogo
     };
 
-    // --- CARREGAMENTO DAS TEXTURAS DOS ITENS ---
-    shop->itemTextures[0] = LoadTexture(ENERGY_POWERUP_PATH);
-    shop->itemTextures[1] = LoadTexture(SHURIKEN_PATH);
-    shop->itemTextures[2] = LoadTexture(SHIELD_PATH);
-    // shop->itemTextures[3] = LoadTexture(EXTRA_LIFE_PATH); // REMOVIDO
-
-    // Aplica o filtro POINT para manter a qualidade pixelada
-    for (int i = 0; i < MAX_SHOP_ITEMS; i++) {
-        if (shop->itemTextures[i].id != 0) SetTextureFilter(shop->itemTextures[i], TEXTURE_FILTER_POINT);
-    }
+    // --- SPRITES DOS ITENS (ATLAS) ---
+    shop->itemSprites[0] = B2_SPRITE_ICON_ENERGY;
+    shop->itemSprites[1] = B2_SPRITE_ICON_SHURIKEN;
+    shop->itemSprites[2] = B2_SPRITE_ICON_SHIELD;
+    // shop->itemSprites[3] = vida extra // REMOVIDO
 
 
     // --- SETUP DOS ITENS NA LOJA ---
@@ -142,21 +135,21 @@ void DrawShopEnvironment(int width, int height) {
 }
 
 // --- FUNÇÃO DE ATUALIZAÇÃO DA LÓGICA DA LOJA ---
-void UpdateShop(ShopScene *shop, Player *player, StarField *stars, GameState *state, float deltaTime) {
+void UpdateShop(ShopScene *shop, Player *player, StarField *stars, GameState *state, const B2Input *input, float deltaTime) {
     UpdateStarField(stars, deltaTime); // O campo de estrelas continua se movendo
 
-    float pW = player->texture.width * player->scale;
-    float pH = player->texture.height * player->scale;
+    float pW = player->size.x;
+    float pH = player->size.y;
     Rectangle playerRect = { player->position.x, player->position.y, pW, pH };
 
     // Só permite movimento se o jogador não acabou de comprar um item (transição de compra)
     if (!shop->itemBought) {
         float speed = player->speed * deltaTime;
         // Movimento do jogador
-        if (IsKeyDown(KEY_LEFT)) player->position.x -= speed;
-        if (IsKeyDown(KEY_RIGHT)) player->position.x += speed;
-        if (IsKeyDown(KEY_UP)) player->position.y -= speed;
-        if (IsKeyDown(KEY_DOWN)) player->position.y += speed;
+        if (IsB2ButtonDown(input, B2_BUTTON_LEFT)) player->position.x -= speed;
+        if (IsB2ButtonDown(input, B2_BUTTON_RIGHT)) player->position.x += speed;
+        if (IsB2ButtonDown(input, B2_BUTTON_UP)) player->position.y -= speed;
+        if (IsB2ButtonDown(input, B2_BUTTON_DOWN)) player->position.y += speed;
 
         // Limita o movimento horizontal do jogador
         player->position.x = Clamp(player->position.x, 0.0f, 800.0f - pW);
@@ -176,7 +169,7 @@ void UpdateShop(ShopScene *shop, Player *player, StarField *stars, GameState *st
             // Informa que precisa de 'P' para sair
             sprintf(shop->dialogText, "PORTAL PRONTO! Pressione P para sair e voltar a acao.");
 
-            if (IsKeyPressed(KEY_P)) {
+            if (IsB2ButtonPressed(input, B2_BUTTON_PORTAL)) {
                 // Transição para o estado de Gameplay
                 *state = STATE_GAMEPLAY;
                 // Reposiciona o jogador no mapa de gameplay
@@ -227,7 +220,7 @@ void UpdateShop(ShopScene *shop, Player *player, StarField *stars, GameState *st
                         if (!player->canCharge) {
                             sprintf(shop->dialogText, "UPGRADE DE ENERGIA: HABILITA O TIRO CARREGADO! PRESSIONE E.");
 
-                            if (IsKeyPressed(KEY_E)) {
+                            if (IsB2ButtonPressed(input, B2_BUTTON_BUY)) {
                                 player->canCharge = true;
                                 shop->itemBought = true;
                                 shop->items[i].active = false; // Desativa o item na loja
@@ -242,7 +235,7 @@ void UpdateShop(ShopScene *shop, Player *player, StarField *stars, GameState *st
 
                         sprintf(shop->dialogText, "COMPRAR %s POR %s? PRESSIONE E.", shop->items[i].name, priceText);
 
-                        if (IsKeyPressed(KEY_E)) {
+                        if (IsB2ButtonPressed(input, B2_BUTTON_BUY)) {
                             // Verifica se tem ouro suficiente
                             if (player->gold >= shop->items[i].price) {
 
@@ -365,45 +358,58 @@ void DrawShop(ShopScene *shop, Player *player, StarField *stars) {
 
 
     // --- DESENHO DOS ITENS ---
+    // Em três passadas (caixas, ícones do atlas, textos) para cada tipo de desenho sair num batch só
+    bool drawItem[MAX_SHOP_ITEMS];
+    Rectangle itemRects[MAX_SHOP_ITEMS];
+
     for (int i = 0; i < MAX_SHOP_ITEMS; i++) {
         // Desenha o item se estiver ativo OU se for o upgrade de energia e o jogador ainda não o tiver
-        bool shouldDrawItem = shop->items[i].active || (shop->items[i].type == ITEM_ENERGY_CHARGE && !player->canCharge);
-
-        if (shouldDrawItem) {
-            Texture2D itemTexture = shop->itemTextures[i];
-            float floatY = sin(time * 3 + i) * 3; // Efeito de flutuação vertical
-            Rectangle drawRect = shop->items[i].rect;
-            drawRect.y += floatY;
-
-            // Desenho da caixa do item (com efeito de glow/sombra)
-            DrawRectangleRec(drawRect, Fade(shop->items[i].color, 0.4f));
-            DrawRectangleLinesEx(drawRect, 2, WHITE);
-
-            // Desenho da textura do item
-            if (itemTexture.id != 0) {
-                float textureScale = drawRect.width / itemTexture.width;
-                Vector2 pos = { drawRect.x, drawRect.y };
-                DrawTextureEx(itemTexture, pos, 0.0f, textureScale, WHITE);
-            }
+        drawItem[i] = shop->items[i].active || (shop->items[i].type == ITEM_ENERGY_CHARGE && !player->canCharge);
 
-            // Nome do Item
-            int nameWidth = MeasureText(shop->items[i].name, 10);
-            DrawText(shop->items[i].name, (int)drawRect.x + (int)drawRect.width/2 - nameWidth/2, (int)drawRect.y - 25, 10, WHITE);
+        float floatY = sin(time * 3 + i) * 3; // Efeito de flutuação vertical
+        itemRects[i] = shop->items[i].rect;
+        itemRects[i].y += floatY;
+    }
 
-            // Preço do Item
-            char priceText[16];
-            if (shop->items[i].price == 0) sprintf(priceText, "GRATIS");
-            else sprintf(priceText, "$%d", shop->items[i].price);
+    // Caixa do item (com efeito de glow/sombra)
+    for (int i = 0; i < MAX_SHOP_ITEMS; i++) {
+        if (!drawItem[i]) continue;
+        DrawRectangleRec(itemRects[i], Fade(shop->items[i].color, 0.4f));
+        DrawRectangleLinesEx(itemRects[i], 2, WHITE);
+    }
 
-            int priceWidth = MeasureText(priceText, 10);
-            DrawText(priceText, (int)drawRect.x + (int)drawRect.width/2 - priceWidth/2, (int)drawRect.y + (int)drawRect.height + 5, 10, YELLOW);
-        }
+    // Ícone do item, na largura da caixa e mantendo a proporção do arquivo original
+    for (int i = 0; i < MAX_SHOP_ITEMS; i++) {
+        B2SpriteId sprite = shop->itemSprites[i];
+        if (!drawItem[i] || !IsB2SpriteLoaded(sprite)) continue;
+
+        Rectangle drawRect = itemRects[i];
+        float textureScale = drawRect.width / b2Atlas.sprites[sprite].width;
+        Rectangle dest = { drawRect.x, drawRect.y, drawRect.width, b2Atlas.sprites[sprite].height * textureScale };
+        DrawB2Sprite(sprite, dest, (Vector2){ 0.0f, 0.0f }, 0.0f, WHITE);
+    }
+
+    for (int i = 0; i < MAX_SHOP_ITEMS; i++) {
+        if (!drawItem[i]) continue;
+        Rectangle drawRect = itemRects[i];
+
+        // Nome do Item
+        int nameWidth = MeasureText(shop->items[i].name, 10);
+        DrawText(shop->items[i].name, (int)drawRect.x + (int)drawRect.width/2 - nameWidth/2, (int)drawRect.y - 25, 10, WHITE);
+
+        // Preço do Item
+        char priceText[16];
+        if (shop->items[i].price == 0) sprintf(priceText, "GRATIS");
+        else sprintf(priceText, "$%d", shop->items[i].price);
+
+        int priceWidth = MeasureText(priceText, 10);
+        DrawText(priceText, (int)drawRect.x + (int)drawRect.width/2 - priceWidth/2, (int)drawRect.y + (int)drawRect.height + 5, 10, YELLOW);
     }
 
     // --- EFEITO DE PARTÍCULAS PÓS-COMPRA ---
     if (shop->showParticles) {
-        float pW = player->texture.width * player->scale;
-        float pH = player->texture.height * player->scale;
+        float pW = player->size.x;
+        float pH = player->size.y;
         Vector2 playerCenter = { player->position.x + pW/2, player->position.y + pH/2 };
 
         Color effectColor = LIME;
@@ -432,9 +438,7 @@ void DrawShop(ShopScene *shop, Player *player, StarField *stars) {
 }
 
 // --- FUNÇÃO DE FINALIZAÇÃO ---
-// Descarrega todas as texturas de item carregadas
+// Os ícones dos itens pertencem ao atlas do Byte Space (UnloadB2Atlas)
 void UnloadShop(ShopScene *shop) {
-    for (int i = 0; i < MAX_SHOP_ITEMS; i++) {
-        if (shop->itemTextures[i].id != 0) UnloadTexture(shop->itemTextures[i]);
-    }
-}
\ No newline at end of file
+    (void)shop;
+}
@@ -0,0 +1,166 @@
+#include "b2_sim.h"
+#include "b2_audio.h"   // b2AudioManager (vazio no headless: as chamadas de som viram nada)
+#include "b2_replay.h"  // HashB2Bytes
+#include "raylib.h"
+
+// --- MEDIÇÃO ---
+// Soma ao sistema o tempo desde a última marca e avança a marca
+static void Charge(B2Sim *sim, B2System system, double *mark) {
+    if (!sim->clock) return;
+    double now = sim->clock();
+    sim->timings.seconds[system] += now - *mark;
+    *mark = now;
+}
+
+// --- PARTIDA ---
+void InitB2Sim(B2Sim *sim) {
+    sim->shouldExit = false;
+
+    InitStarField(&sim->starField, B2_STAR_COUNT, B2_GAME_WIDTH, B2_GAME_HEIGHT);
+
+    InitPlayer(&sim->player);
+    sim->player.gold = 0;
+
+    InitHud(&sim->hud);
+    InitBulletManager(&sim->bulletManager);
+    InitEnemyManager(&sim->enemyManager, B2_GAME_WIDTH, B2_GAME_HEIGHT);
+
+    InitShop(&sim->shop, &sim->player, B2_GAME_WIDTH, B2_GAME_HEIGHT);
+    InitCutscene(&sim->cutscene);
+
+    // Estado Inicial
+    sim->state = STATE_CUTSCENE;
+
+    // Posição Jogador
+    sim->player.position.x = B2_GAME_WIDTH / 2 - sim->player.size.x / 2;
+    sim->player.position.y = B2_GAME_HEIGHT - sim->player.size.y - 100.0f;
+}
+
+void UnloadB2Sim(B2Sim *sim) {
+    UnloadShop(&sim->shop);
+    UnloadPlayer(&sim->player);
+    UnloadBulletManager(&sim->bulletManager);
+    UnloadEnemyManager(&sim->enemyManager);
+}
+
+// --- TICK ---
+void StepB2Sim(B2Sim *sim, const B2Input *input, float dt) {
+    Player *player = &sim->player;
+    EnemyManager *enemyManager = &sim->enemyManager;
+    double mark = sim->clock ? sim->clock() : 0.0;
+
+    switch (sim->state) {
+        case STATE_CUTSCENE:
+            UpdateCutscene(&sim->cutscene, &sim->state, input, dt);
+            if (sim->state == STATE_SHOP) {
+                StopMusicStream(b2AudioManager.musicCutscene);
+                PlayMusicTrack(&b2AudioManager, MUSIC_SHOP);
+            }
+            Charge(sim, B2_SYSTEM_SCENES, &mark);
+            break;
+
+        case STATE_ENDING:
+            UpdateCutscene(&sim->cutscene, &sim->state, input, dt);
+            if (IsB2ButtonPressed(input, B2_BUTTON_CONFIRM)) {
+                sim->shouldExit = true;
+            }
+            Charge(sim, B2_SYSTEM_SCENES, &mark);
+            break;
+
+        case STATE_SHOP:
+            UpdateShop(&sim->shop, player, &sim->starField, &sim->state, input, dt);
+            Charge(sim, B2_SYSTEM_SCENES, &mark);
+            UpdatePlayerBullets(&sim->bulletManager, dt);
+            Charge(sim, B2_SYSTEM_BULLETS, &mark);
+            if (sim->state == STATE_GAMEPLAY) {
+                StopMusicStream(b2AudioManager.musicShop);
+                PlayMusicTrack(&b2AudioManager, MUSIC_GAMEPLAY);
+            }
+            break;
+
+        case STATE_GAMEPLAY: {
+            UpdateStarField(&sim->starField, dt);
+            UpdateHud(&sim->hud, dt);
+            Charge(sim, B2_SYSTEM_SCENES, &mark);
+
+            bool isActionPaused = enemyManager->triggerShopReturn || enemyManager->waveStartTimer > 0 || enemyManager->gameOver;
+
+            if (!isActionPaused) {
+                UpdatePlayer(player, &sim->bulletManager, &b2AudioManager, &sim->hud, input, dt, B2_GAME_WIDTH, B2_GAME_HEIGHT);
+                Charge(sim, B2_SYSTEM_PLAYER, &mark);
+            }
+            UpdatePlayerBullets(&sim->bulletManager, dt);
+            Charge(sim, B2_SYSTEM_BULLETS, &mark);
+            UpdateExplosions(enemyManager, dt);
+            Charge(sim, B2_SYSTEM_PARTICLES, &mark);
+            UpdateEnemies(enemyManager, dt, B2_GAME_WIDTH, &player->currentLives, &enemyManager->gameOver);
+            Charge(sim, B2_SYSTEM_ENEMIES, &mark);
+
+            if (!isActionPaused) {
+                CheckBulletEnemyCollision(&sim->bulletManager, enemyManager, &player->gold, &b2AudioManager);
+                Charge(sim, B2_SYSTEM_COLLISION, &mark);
+            }
+
+            if (enemyManager->triggerShopReturn) {
+                if (enemyManager->currentWave == 10) {
+                    InitEnding(&sim->cutscene);
+                    sim->state = STATE_ENDING;
+                    enemyManager->triggerShopReturn = false;
+                    StopMusicStream(b2AudioManager.musicGameplay);
+                } else {
+                    if (IsB2ButtonPressed(input, B2_BUTTON_BUY)) {
+                        sim->state = STATE_SHOP;
+                        enemyManager->triggerShopReturn = false;
+                        StopMusicStream(b2AudioManager.musicGameplay);
+                        PlayMusicTrack(&b2AudioManager, MUSIC_SHOP);
+                    }
+                    if (IsB2ButtonPressed(input, B2_BUTTON_SKIP)) {
+                        enemyManager->triggerShopReturn = false;
+                    }
+                }
+            }
+
+            if (enemyManager->gameOver && IsB2ButtonPressed(input, B2_BUTTON_CONFIRM)) {
+                sim->shouldExit = true;
+            }
+            Charge(sim, B2_SYSTEM_SCENES, &mark);
+            break;
+        }
+
+        default:
+            break;
+    }
+    sim->timings.ticks++;
+}
+
+// --- HASH ---
+// Dois estados com o mesmo hash depois do mesmo número de ticks são a mesma partida
+uint64_t HashB2Sim(const B2Sim *sim) {
+    const Player *player = &sim->player;
+    const EnemyManager *enemyManager = &sim->enemyManager;
+
+    uint64_t h = B2_HASH_SEED;
+    h = HashB2Bytes(h, &sim->state, sizeof(sim->state));
+    h = HashB2Bytes(h, &player->position, sizeof(player->position));
+    h = HashB2Bytes(h, &player->gold, sizeof(player->gold));
+    h = HashB2Bytes(h, &player->currentLives, sizeof(player->currentLives));
+    h = HashB2Bytes(h, &player->energyCharge, sizeof(player->energyCharge));
+    h = HashB2Bytes(h, &enemyManager->currentWave, sizeof(enemyManager->currentWave));
+    h = HashB2Bytes(h, &enemyManager->alive.count, sizeof(enemyManager->alive.count));
+    h = HashB2Bytes(h, &enemyManager->gameOver, sizeof(enemyManager->gameOver));
+    const EnemyFormation *formation = &enemyManager->formation;
+    h = HashB2Bytes(h, formation->x, sizeof(formation->x));
+    h = HashB2Bytes(h, formation->y, sizeof(formation->y));
+    h = HashB2Bytes(h, formation->live, sizeof(formation->live));
+    h = HashB2Bytes(h, formation->health, sizeof(formation->health));
+    h = HashB2Bytes(h, &enemyManager->boss.position, sizeof(enemyManager->boss.position));
+    h = HashB2Bytes(h, &enemyManager->boss.health, sizeof(enemyManager->boss.health));
+    h = HashB2Bytes(h, &enemyManager->boss.active, sizeof(enemyManager->boss.active));
+    for (int i = 0; i < MAX_PLAYER_BULLETS; i++) {
+        bool live = BulletPoolIds_IsLive(&sim->bulletManager.bullets.ids, i);
+        h = HashB2Bytes(h, &live, sizeof(live));
+        if (live) h = HashB2Bytes(h, &sim->bulletManager.bullets.items[i].rect, sizeof(Rectangle));
+    }
+    h = HashB2Bytes(h, &enemyManager->particles.count, sizeof(enemyManager->particles.count));
+    return h;
+}
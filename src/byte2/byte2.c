@@ -2,25 +2,34 @@
 #include "raylib.h"
 
 // Inclui os cabeçalhos dos módulos do jogo
-#include "b2_player.h"
+#include "b2_sim.h"   // Estado da partida e o tick (jogador, tiros, inimigos, loja, cutscenes)
 #include "b2_hud.h"
-#include "b2_bullet.h"
 #include "b2_audio.h" // Isso traz 'extern b2AudioManager'
-#include "b2_star.h"
-#include "b2_game_state.h"
-#include "b2_shop.h"
-#include "b2_cutscene.h"
-#include "b2_enemy.h"
+#include "b2_atlas.h"
+#include "b2_input.h"
+#include "b2_rng.h"
+#include "b2_replay.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdbool.h>
 #include <math.h>
-
-// --- DEFINIÇÕES ---
-#define GAME_WIDTH 800
-#define GAME_HEIGHT 600
-
-const int STAR_COUNT = 150;
+#include <time.h>
+
+// --- PASSO FIXO ---
+// A simulação (b2_sim) roda em ticks de B2_TICK_DT, quantos couberem no tempo acumulado; o
+// desenho interpola entre os dois últimos ticks. O frame é limitado a MAX_FRAME_TIME para
+// que uma travada (arrastar a janela, carregar asset) não vire centenas de ticks seguidos
+#define MAX_FRAME_TIME 0.25f
+// Deslocamentos maiores que isso em um tick são teleportes (nova onda, saída da loja): sem interpolação
+#define INTERPOLATION_SNAP_DISTANCE 64.0f
+
+// --- REPLAY ---
+// Variáveis de ambiente que trocam o teclado por um .b2r (ver byte2.h)
+#define REPLAY_ENV "BYTE2_REPLAY"
+#define REPLAY_FAST_ENV "BYTE2_REPLAY_FAST"
+// No modo rápido, simula no máximo isso por frame para a janela continuar respondendo
+#define FAST_REPLAY_FRAME_BUDGET 0.05
 
 // --- GLOBAIS ---
 // REMOVIDO: static AudioManager audioManager; -> A variável agora vive em b2_audio.c
@@ -31,26 +40,44 @@ static int locResolution;
 static int locTime;
 static RenderTexture2D target;
 
-// Objetos do jogo
-static StarField starField;
-static Player player;
-static Hud hud;
-static BulletManager bulletManager;
-static EnemyManager enemyManager;
-static ShopScene shop;
-static CutsceneScene cutscene;
-static GameState currentState;
-
-// Variável de controle de saída
-static bool shouldExitGame = false;
+// Partida (objetos do jogo e estado)
+static B2Sim sim;
+
+// --- ESTADO DO PASSO FIXO ---
+/**
+ * @brief Posições desenhadas de tudo o que se move, copiadas a cada tick para a interpolação.
+ */
+typedef struct {
+    GameState state;
+    Vector2 player;
+    Vector2 boss;
+    Vector2 enemies[ENEMY_COUNT];
+    Vector2 bullets[MAX_PLAYER_BULLETS];    // Canto do rect (é o que o DrawPlayerBullets usa).
+    bool bulletActive[MAX_PLAYER_BULLETS];
+} RenderPose;
+
+static float tickAccumulator = 0.0f;
+static uint16_t previousButtons = 0;    // Botões do último tick (para as bordas apertou/soltou).
+static uint16_t pendingTaps = 0;        // Teclas tocadas desde o último tick (um toque rápido não se perde).
+static RenderPose previousPose;         // Pose antes do último tick.
+static RenderPose currentPose;          // Pose depois do último tick (restaurada após o desenho).
+
+// --- ESTADO DO REPLAY ---
+typedef enum { REPLAY_OFF, REPLAY_REALTIME, REPLAY_FAST } ReplayMode;
+
+static B2Replay replay;                 // A partida sendo gravada (REPLAY_OFF) ou tocada.
+static ReplayMode replayMode = REPLAY_OFF;
+static uint32_t ticksRun = 0;
+static double replaySimSeconds = 0.0;   // Tempo gasto nos ticks do modo rápido.
+static float savedMasterVolume = 1.0f;  // O modo rápido fica mudo.
 
 // --- FUNÇÕES AUXILIARES (UI) ---
 static void DrawShopTransitionUI(EnemyManager *manager) {
     if (!manager->triggerShopReturn) return;
 
-    DrawRectangle(0, 0, GAME_WIDTH, GAME_HEIGHT, Fade(BLACK, 0.9f));
+    DrawRectangle(0, 0, B2_GAME_WIDTH, B2_GAME_HEIGHT, Fade(BLACK, 0.9f));
 
-    Rectangle panel = { GAME_WIDTH / 2.0f - 220, GAME_HEIGHT / 2.0f - 110, 440, 220 };
+    Rectangle panel = { B2_GAME_WIDTH / 2.0f - 220, B2_GAME_HEIGHT / 2.0f - 110, 440, 220 };
     Color NEON_MAGENTA = (Color){255, 0, 150, 255};
     Color NEON_CYAN = (Color){0, 255, 255, 255};
     Color NEON_GREEN = (Color){0, 255, 0, 255};
@@ -84,11 +111,66 @@ static void DrawShopTransitionUI(EnemyManager *manager) {
     DrawText(skipText, optionX2, (int)panel.y + 170, optionFontSize, NEON_MAGENTA);
 }
 
+// --- INTERPOLAÇÃO ---
+static void CapturePose(RenderPose *pose) {
+    pose->state = sim.state;
+    pose->player = sim.player.position;
+    pose->boss = sim.enemyManager.boss.position;
+    const EnemyFormation *formation = &sim.enemyManager.formation;
+    for (int i = 0; i < ENEMY_COUNT; i++) pose->enemies[i] = (Vector2){ formation->x[i], formation->y[i] };
+    for (int i = 0; i < MAX_PLAYER_BULLETS; i++) {
+        const Bullet *bullet = &sim.bulletManager.bullets.items[i];
+        pose->bullets[i] = (Vector2){ bullet->rect.x, bullet->rect.y };
+        pose->bulletActive[i] = BulletPoolIds_IsLive(&sim.bulletManager.bullets.ids, i);
+    }
+}
+
+static void RestorePose(const RenderPose *pose) {
+    sim.player.position = pose->player;
+    sim.enemyManager.boss.position = pose->boss;
+    EnemyFormation *formation = &sim.enemyManager.formation;
+    for (int i = 0; i < ENEMY_COUNT; i++) {
+        formation->x[i] = pose->enemies[i].x;
+        formation->y[i] = pose->enemies[i].y;
+    }
+    for (int i = 0; i < MAX_PLAYER_BULLETS; i++) {
+        sim.bulletManager.bullets.items[i].rect.x = pose->bullets[i].x;
+        sim.bulletManager.bullets.items[i].rect.y = pose->bullets[i].y;
+    }
+}
+
+static Vector2 BlendPosition(Vector2 from, Vector2 to, float alpha) {
+    float dx = to.x - from.x, dy = to.y - from.y;
+    if (dx * dx + dy * dy > INTERPOLATION_SNAP_DISTANCE * INTERPOLATION_SNAP_DISTANCE) return to;
+    return (Vector2){ from.x + dx * alpha, from.y + dy * alpha };
+}
+
+// Põe nos objetos as posições entre o tick anterior e o atual. Só o desenho vê esses valores:
+// o RestorePose(&currentPose) devolve o estado exato da simulação logo depois
+static void ApplyBlendedPose(float alpha) {
+    if (previousPose.state != currentPose.state) return;
+
+    sim.player.position = BlendPosition(previousPose.player, currentPose.player, alpha);
+    sim.enemyManager.boss.position = BlendPosition(previousPose.boss, currentPose.boss, alpha);
+    EnemyFormation *formation = &sim.enemyManager.formation;
+    for (int i = 0; i < ENEMY_COUNT; i++) {
+        Vector2 position = BlendPosition(previousPose.enemies[i], currentPose.enemies[i], alpha);
+        formation->x[i] = position.x;
+        formation->y[i] = position.y;
+    }
+    for (int i = 0; i < MAX_PLAYER_BULLETS; i++) {
+        if (!previousPose.bulletActive[i]) continue; // Acabou de sair: nasce onde foi disparada
+        Vector2 corner = BlendPosition(previousPose.bullets[i], currentPose.bullets[i], alpha);
+        sim.bulletManager.bullets.items[i].rect.x = corner.x;
+        sim.bulletManager.bullets.items[i].rect.y = corner.y;
+    }
+}
+
 static void DrawWaveStartUI(EnemyManager *manager) {
     float t = manager->waveStartTimer;
     if (t <= 0) return;
 
-    DrawRectangle(0, 0, GAME_WIDTH, GAME_HEIGHT, Fade(BLACK, 0.4f));
+    DrawRectangle(0, 0, B2_GAME_WIDTH, B2_GAME_HEIGHT, Fade(BLACK, 0.4f));
 
     float pulseRate = 6.0f;
     float alpha = 0.5f + (sinf((float)GetTime() * pulseRate) + 1.0f) * 0.25f;
@@ -100,12 +182,106 @@ static void DrawWaveStartUI(EnemyManager *manager) {
     int fontSize = 50;
     int textWidth = MeasureText(text, fontSize);
 
-    DrawText(text, (GAME_WIDTH - textWidth) / 2, GAME_HEIGHT / 2 - fontSize, fontSize, Fade(RAYWHITE, alpha));
+    DrawText(text, (B2_GAME_WIDTH - textWidth) / 2, B2_GAME_HEIGHT / 2 - fontSize, fontSize, Fade(RAYWHITE, alpha));
 
     const char *timerText = TextFormat("%.1f", t);
     int timerFontSize = 30;
     int timerTextWidth = MeasureText(timerText, timerFontSize);
-    DrawText(timerText, (GAME_WIDTH - timerTextWidth) / 2, GAME_HEIGHT / 2 + 20, timerFontSize, Fade(YELLOW, alpha));
+    DrawText(timerText, (B2_GAME_WIDTH - timerTextWidth) / 2, B2_GAME_HEIGHT / 2 + 20, timerFontSize, Fade(YELLOW, alpha));
+}
+
+// Com BYTE2_REPLAY definido, toca o arquivo (semente dele); senão, semente nova e a partida é gravada
+static void StartReplayOrRecording(void) {
+    replayMode = REPLAY_OFF;
+    ticksRun = 0;
+    replaySimSeconds = 0.0;
+
+    const char *path = getenv(REPLAY_ENV);
+    if (path && path[0] != '\0' && LoadB2Replay(&replay, path)) {
+        if (replay.tickRate == B2_TICK_RATE) {
+            replayMode = getenv(REPLAY_FAST_ENV) ? REPLAY_FAST : REPLAY_REALTIME;
+            SeedB2Rng(replay.seed);
+            printf("Replay %s: %u ticks, semente %u%s.\n", path, (unsigned)replay.tickCount, (unsigned)replay.seed,
+                   (replayMode == REPLAY_FAST) ? " (rapido, sem desenho)" : "");
+            if (replayMode == REPLAY_FAST) {
+                savedMasterVolume = GetMasterVolume();
+                SetMasterVolume(0.0f);
+            }
+            return;
+        }
+        printf("AVISO: Replay %s gravado a %u ticks/s (o jogo roda a %d); gravando uma partida nova.\n",
+               path, (unsigned)replay.tickRate, B2_TICK_RATE);
+    }
+
+    SeedB2Rng((uint32_t)time(NULL));
+    BeginB2Recording(&replay, GetB2RngSeed(), B2_TICK_RATE);
+}
+
+// Botões do próximo tick: do replay ou do teclado (e aí entram na gravação)
+static bool NextTickButtons(uint16_t heldButtons, uint16_t *buttons) {
+    if (replayMode != REPLAY_OFF) return NextB2ReplayTick(&replay, buttons);
+
+    *buttons = heldButtons | pendingTaps;
+    pendingTaps = 0;
+    RecordB2Tick(&replay, *buttons);
+    return true;
+}
+
+// Um tick completo: entrada, simulação e pose. Retorna false quando o replay acabou
+static bool RunTick(uint16_t heldButtons) {
+    uint16_t buttons;
+    if (!NextTickButtons(heldButtons, &buttons)) return false;
+
+    B2Input input = MakeB2Input(previousButtons, buttons);
+    previousButtons = buttons;
+
+    previousPose = currentPose;
+    StepB2Sim(&sim, &input, B2_TICK_DT);
+    CapturePose(&currentPose);
+    ticksRun++;
+    return true;
+}
+
+// Fim do replay: resultado no console e volta ao lobby
+static void FinishReplay(void) {
+    uint64_t hash = HashB2Sim(&sim);
+    printf("Replay: %u de %u ticks (%.1f s de jogo).\n", (unsigned)ticksRun, (unsigned)replay.tickCount, ticksRun / (double)B2_TICK_RATE);
+    if (replaySimSeconds > 0.0) {
+        printf("  simulacao: %.3f s, %.0f ticks/s (%.1fx o tempo real)\n", replaySimSeconds, ticksRun / replaySimSeconds,
+               ticksRun / (double)B2_TICK_RATE / replaySimSeconds);
+    }
+    if (replay.finalHash == 0) {
+        printf("AVISO: Replay sem hash final, nada a conferir.\n");
+    } else if (ticksRun == replay.tickCount && hash == replay.finalHash) {
+        printf("Replay OK: estado final igual ao gravado.\n");
+    } else {
+        printf("ERRO: Replay divergiu (hash %016llx, gravado %016llx).\n", (unsigned long long)hash, (unsigned long long)replay.finalHash);
+    }
+    sim.shouldExit = true;
+}
+
+// Modo rápido: ticks seguidos sem desenhar o jogo, só uma linha de progresso por frame
+static bool RunFastReplay(void) {
+    bool ended = false;
+    double start = GetTime();
+    while (!sim.shouldExit && GetTime() - start < FAST_REPLAY_FRAME_BUDGET) {
+        if (!RunTick(0)) {
+            ended = true;
+            break;
+        }
+    }
+    replaySimSeconds += GetTime() - start;
+
+    if (ended || sim.shouldExit) {
+        FinishReplay();
+        return false;
+    }
+
+    BeginDrawing();
+        ClearBackground(BLACK);
+        DrawText(TextFormat("REPLAY %u / %u ticks", (unsigned)ticksRun, (unsigned)replay.tickCount), 20, 20, 20, RAYWHITE);
+    EndDrawing();
+    return true;
 }
 
 // ============================================================================
@@ -113,10 +289,8 @@ static void DrawWaveStartUI(EnemyManager *manager) {
 // ============================================================================
 
 bool ByteSpace_Init(int width, int height) {
-    shouldExitGame = false;
-
     // --- RENDER TEXTURE ---
-    target = LoadRenderTexture(GAME_WIDTH, GAME_HEIGHT);
+    target = LoadRenderTexture(B2_GAME_WIDTH, B2_GAME_HEIGHT);
 
     // --- SHADER CRT ---
     if (FileExists("assets/byte2/shaders/crt22.fs")) {
@@ -132,40 +306,37 @@ bool ByteSpace_Init(int width, int height) {
     SetShaderValue(crtShader, locResolution, initialRes, SHADER_UNIFORM_VEC2);
 
     // --- INICIALIZAÇÃO ---
-    InitStarField(&starField, STAR_COUNT, GAME_WIDTH, GAME_HEIGHT);
-    InitStarField(&sideStarField, STAR_COUNT / 2, width, height);
+    InitStarField(&sideStarField, B2_STAR_COUNT / 2, width, height);
 
-    InitPlayer(&player);
-    player.gold = 0;
+    // Atlas dos sprites (inimigos, Boss, tiros e ícones) antes dos módulos que desenham com ele.
+    // Montado na primeira visita e mantido: voltar ao Byte Space não decodifica nada de novo
+    InitB2Atlas();
 
-    InitHud(&hud);
-    InitBulletManager(&bulletManager);
-    InitEnemyManager(&enemyManager, GAME_WIDTH, GAME_HEIGHT);
+    // Semente antes de qualquer módulo sortear algo: a do replay ou uma nova, gravada
+    StartReplayOrRecording();
 
     // CORREÇÃO: Usar a variável global b2AudioManager
     InitAudioManager(&b2AudioManager);
 
-    InitShop(&shop, &player, GAME_WIDTH, GAME_HEIGHT);
-    InitCutscene(&cutscene);
-
-    // Estado Inicial
-    currentState = STATE_CUTSCENE;
+    // Partida na intro (jogador, tiros, inimigos, loja, cutscenes)
+    sim.clock = NULL;
+    InitB2Sim(&sim);
 
     // CORREÇÃO: b2AudioManager
     PlayMusicTrack(&b2AudioManager, MUSIC_CUTSCENE);
 
-    // Posição Jogador
-    float player_width_scaled  = player.texture.width * player.scale;
-    float player_height_scaled = player.texture.height * player.scale;
-    player.position.x = GAME_WIDTH/2 - player_width_scaled/2;
-    player.position.y = GAME_HEIGHT - player_height_scaled - 100.0f;
+    tickAccumulator = 0.0f;
+    previousButtons = 0;
+    pendingTaps = 0;
+    CapturePose(&currentPose);
+    previousPose = currentPose;
 
     return true;
 }
 
 bool ByteSpace_UpdateDraw(float dt) {
 
-    if (shouldExitGame) return false;
+    if (sim.shouldExit) return false;
 
     if (IsKeyPressed(KEY_ESCAPE)) {
         return false;
@@ -174,11 +345,11 @@ bool ByteSpace_UpdateDraw(float dt) {
     // --- ESCALA ---
     int screenW = GetScreenWidth();
     int screenH = GetScreenHeight();
-    float scaleX = (float)screenW / GAME_WIDTH;
-    float scaleY = (float)screenH / GAME_HEIGHT;
+    float scaleX = (float)screenW / B2_GAME_WIDTH;
+    float scaleY = (float)screenH / B2_GAME_HEIGHT;
     float scale = (scaleX < scaleY) ? scaleX : scaleY;
-    int offsetX = (screenW - (int)(GAME_WIDTH * scale)) / 2;
-    int offsetY = (screenH - (int)(GAME_HEIGHT * scale)) / 2;
+    int offsetX = (screenW - (int)(B2_GAME_WIDTH * scale)) / 2;
+    int offsetY = (screenH - (int)(B2_GAME_HEIGHT * scale)) / 2;
 
     // --- UPDATE SHADER ---
     float t = GetTime();
@@ -191,107 +362,60 @@ bool ByteSpace_UpdateDraw(float dt) {
     UpdateAudioManager(&b2AudioManager);
     UpdateStarField(&sideStarField, dt);
 
-    switch (currentState) {
-        case STATE_CUTSCENE:
-            UpdateCutscene(&cutscene, &currentState, dt);
-            if (currentState == STATE_SHOP) {
-                // CORREÇÃO: b2AudioManager
-                StopMusicStream(b2AudioManager.musicCutscene);
-                PlayMusicTrack(&b2AudioManager, MUSIC_SHOP);
-            }
-            break;
-
-        case STATE_ENDING:
-            UpdateCutscene(&cutscene, &currentState, dt);
-            if (IsKeyPressed(KEY_ENTER)) {
-                shouldExitGame = true;
-            }
-            break;
-
-        case STATE_SHOP:
-            UpdateShop(&shop, &player, &starField, &currentState, dt);
-            UpdatePlayerBullets(&bulletManager, dt);
-            if (currentState == STATE_GAMEPLAY) {
-                // CORREÇÃO: b2AudioManager
-                StopMusicStream(b2AudioManager.musicShop);
-                PlayMusicTrack(&b2AudioManager, MUSIC_GAMEPLAY);
-            }
-            break;
-
-        case STATE_GAMEPLAY:
-            UpdateStarField(&starField, dt);
-            UpdateHud(&hud, dt);
-
-            bool isActionPaused = enemyManager.triggerShopReturn || enemyManager.waveStartTimer > 0 || enemyManager.gameOver;
-
-            if (!isActionPaused) {
-                // CORREÇÃO: b2AudioManager
-                UpdatePlayer(&player, &bulletManager, &b2AudioManager, &hud, dt, GAME_WIDTH, GAME_HEIGHT);
-            }
-            UpdatePlayerBullets(&bulletManager, dt);
-            UpdateEnemies(&enemyManager, dt, GAME_WIDTH, &player.currentLives, &enemyManager.gameOver);
-
-            if (!isActionPaused) {
-                // CORREÇÃO: b2AudioManager
-                CheckBulletEnemyCollision(&bulletManager, &enemyManager, &player.gold, &b2AudioManager);
-            }
+    if (replayMode == REPLAY_FAST) return RunFastReplay();
 
-            if (enemyManager.triggerShopReturn) {
-                if (enemyManager.currentWave == 10) {
-                    InitEnding(&cutscene);
-                    currentState = STATE_ENDING;
-                    enemyManager.triggerShopReturn = false;
-                    // CORREÇÃO: b2AudioManager
-                    StopMusicStream(b2AudioManager.musicGameplay);
-                } else {
-                    if (IsKeyPressed(KEY_E)) {
-                        currentState = STATE_SHOP;
-                        enemyManager.triggerShopReturn = false;
-                        // CORREÇÃO: b2AudioManager
-                        StopMusicStream(b2AudioManager.musicGameplay);
-                        PlayMusicTrack(&b2AudioManager, MUSIC_SHOP);
-                    }
-                    if (IsKeyPressed(KEY_F)) {
-                        enemyManager.triggerShopReturn = false;
-                    }
-                }
-            }
+    // --- SIMULAÇÃO (PASSO FIXO) ---
+    uint16_t taps = 0;
+    uint16_t heldButtons = ReadB2Buttons(&taps);
+    pendingTaps |= taps;
 
-            if (enemyManager.gameOver && IsKeyPressed(KEY_ENTER)) {
-                return false;
-            }
+    // Para no tick que encerrou o jogo: a gravação termina exatamente nele
+    bool replayEnded = false;
+    tickAccumulator += fminf(dt, MAX_FRAME_TIME);
+    while (tickAccumulator >= B2_TICK_DT && !sim.shouldExit) {
+        if (!RunTick(heldButtons)) {
+            replayEnded = true;
             break;
+        }
+        tickAccumulator -= B2_TICK_DT;
+    }
+    if (replayMode != REPLAY_OFF && (replayEnded || sim.shouldExit)) {
+        FinishReplay();
+        return false;
     }
+    if (sim.shouldExit) return false;
+
+    ApplyBlendedPose(tickAccumulator / B2_TICK_DT);
 
     // --- DRAW ---
     BeginTextureMode(target);
         ClearBackground(BLACK);
-        switch (currentState) {
+        switch (sim.state) {
             case STATE_CUTSCENE:
             case STATE_ENDING:
-                DrawCutscene(&cutscene, GAME_WIDTH, GAME_HEIGHT);
+                DrawCutscene(&sim.cutscene, B2_GAME_WIDTH, B2_GAME_HEIGHT);
                 break;
             case STATE_SHOP:
-                DrawShop(&shop, &player, &starField);
-                DrawPlayerBullets(&bulletManager);
+                DrawShop(&sim.shop, &sim.player, &sim.starField);
+                DrawPlayerBullets(&sim.bulletManager);
                 break;
             case STATE_GAMEPLAY:
-                DrawStarField(&starField);
+                DrawStarField(&sim.starField);
                 const Color NEON_GREEN_LINE = (Color){ 0, 255, 0, 255 };
-                DrawRectangle(0, (int)ENEMY_GAME_OVER_LINE_Y, GAME_WIDTH, 2, NEON_GREEN_LINE);
-                DrawRectangle(0, (int)ENEMY_GAME_OVER_LINE_Y - 2, GAME_WIDTH, 2, Fade(NEON_GREEN_LINE, 0.4f));
-                DrawRectangle(0, (int)ENEMY_GAME_OVER_LINE_Y + 2, GAME_WIDTH, 2, Fade(NEON_GREEN_LINE, 0.4f));
-                DrawEnemies(&enemyManager);
-                DrawPlayer(&player);
-                DrawPlayerBullets(&bulletManager);
-                DrawWaveStartUI(&enemyManager);
-                if (enemyManager.triggerShopReturn && enemyManager.currentWave < 10) {
-                    DrawShopTransitionUI(&enemyManager);
+                DrawRectangle(0, (int)ENEMY_GAME_OVER_LINE_Y, B2_GAME_WIDTH, 2, NEON_GREEN_LINE);
+                DrawRectangle(0, (int)ENEMY_GAME_OVER_LINE_Y - 2, B2_GAME_WIDTH, 2, Fade(NEON_GREEN_LINE, 0.4f));
+                DrawRectangle(0, (int)ENEMY_GAME_OVER_LINE_Y + 2, B2_GAME_WIDTH, 2, Fade(NEON_GREEN_LINE, 0.4f));
+                DrawEnemies(&sim.enemyManager);
+                DrawPlayer(&sim.player);
+                DrawPlayerBullets(&sim.bulletManager);
+                DrawWaveStartUI(&sim.enemyManager);
+                if (sim.enemyManager.triggerShopReturn && sim.enemyManager.currentWave < 10) {
+                    DrawShopTransitionUI(&sim.enemyManager);
                 }
-                if (enemyManager.gameOver) {
-                    DrawRectangle(0, 0, GAME_WIDTH, GAME_HEIGHT, Fade(BLACK, 0.8f));
-                    DrawText("GAME OVER", GAME_WIDTH/2 - MeasureText("GAME OVER", 40)/2, GAME_HEIGHT/2 - 20, 40, RED);
-                    DrawText("Pressione [ENTER] para sair", GAME_WIDTH/2 - MeasureText("Pressione [ENTER] para sair", 20)/2, GAME_HEIGHT/2 + 30, 20, WHITE);
+                if (sim.enemyManager.gameOver) {
+                    DrawRectangle(0, 0, B2_GAME_WIDTH, B2_GAME_HEIGHT, Fade(BLACK, 0.8f));
+                    DrawText("GAME OVER", B2_GAME_WIDTH/2 - MeasureText("GAME OVER", 40)/2, B2_GAME_HEIGHT/2 - 20, 40, RED);
+                    DrawText("Pressione [ENTER] para sair", B2_GAME_WIDTH/2 - MeasureText("Pressione [ENTER] para sair", 20)/2, B2_GAME_HEIGHT/2 + 30, 20, WHITE);
                 }
                 break;
         }
@@ -304,27 +428,44 @@ bool ByteSpace_UpdateDraw(float dt) {
         BeginShaderMode(crtShader);
             DrawTexturePro(target.texture,
                 (Rectangle){0, 0, (float)target.texture.width, -(float)target.texture.height},
-                (Rectangle){(float)offsetX, (float)offsetY, GAME_WIDTH * scale, GAME_HEIGHT * scale},
+                (Rectangle){(float)offsetX, (float)offsetY, B2_GAME_WIDTH * scale, B2_GAME_HEIGHT * scale},
                 (Vector2){0, 0}, 0.0f, WHITE);
         EndShaderMode();
 
-        if (currentState == STATE_GAMEPLAY && offsetX > 0) {
-            DrawHudSide(&hud, true, offsetY, player.energyCharge, player.hasDoubleShot, player.hasShield, player.extraLives, player.currentLives, player.gold);
-            DrawHudSide(&hud, false, offsetY, 0.0f, false, false, 0, player.currentLives, player.gold);
+        if (sim.state == STATE_GAMEPLAY && offsetX > 0) {
+            DrawHudSide(true, offsetY, sim.player.energyCharge, sim.player.hasDoubleShot, sim.player.hasShield, sim.player.extraLives, sim.player.currentLives, sim.player.gold);
+            DrawHudSide(false, offsetY, 0.0f, false, false, 0, sim.player.currentLives, sim.player.gold);
         }
     EndDrawing();
 
+    RestorePose(&currentPose);
     return true;
 }
 
 void ByteSpace_Unload(void) {
-    UnloadShop(&shop);
-    UnloadPlayer(&player);
+    // Grava a partida jogada (o hash sai antes de qualquer Unload mexer no estado)
+    if (replayMode == REPLAY_OFF && replay.failed) {
+        printf("AVISO: Gravacao do replay incompleta (sem memoria); %s nao foi gravado.\n", B2_REPLAY_FILE);
+    } else if (replayMode == REPLAY_OFF && replay.tickCount > 0) {
+        replay.finalHash = HashB2Sim(&sim);
+        if (SaveB2Replay(&replay, B2_REPLAY_FILE)) {
+            printf("Replay gravado em %s (%u ticks, semente %u).\n", B2_REPLAY_FILE, (unsigned)replay.tickCount, (unsigned)replay.seed);
+        }
+    }
+    if (replayMode == REPLAY_FAST) SetMasterVolume(savedMasterVolume);
+    UnloadB2Replay(&replay);
+    replayMode = REPLAY_OFF;
+
+    UnloadB2Sim(&sim);
     UnloadRenderTexture(target);
-    UnloadBulletManager(&bulletManager);
 
     // CORREÇÃO: Unload b2AudioManager
     UnloadAudioManager(&b2AudioManager);
 
+    // O atlas fica residente até o ByteSpace_Shutdown
     UnloadShader(crtShader);
+}
+
+void ByteSpace_Shutdown(void) {
+    UnloadB2Atlas();
 }
\ No newline at end of file
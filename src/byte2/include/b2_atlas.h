@@ -0,0 +1,95 @@
+#ifndef B2_ATLAS_H
+#define B2_ATLAS_H
+
+#include "raylib.h"
+#include "b2_enemy.h" // BOSS_FRAME_COUNT
+#include <stdbool.h>
+
+// --- CONSTANTES DO ATLAS ---
+#define B2_ATLAS_PAGE_SIZE 2048         // Lado máximo de cada página (textura) do atlas.
+#define B2_ATLAS_MAX_PAGES 4            // Uma página por filtro (pixel art / suave); extras só se não couber.
+#define B2_ATLAS_MAX_SPRITE_SIZE 256    // Lado maior de cada sprite no atlas (os PNGs têm até 1024px).
+#define B2_ATLAS_PADDING 2              // Espaço entre sprites (evita vazamento do filtro bilinear).
+
+// --- IDENTIFICADORES DOS SPRITES ---
+typedef enum {
+    // Inimigos
+    B2_SPRITE_ENEMY_1 = 0,
+    B2_SPRITE_ENEMY_2,
+    B2_SPRITE_ENEMY_3,
+
+    // Auras neon dos inimigos, uma por tipo/cor (geradas no carregamento, sem arquivo)
+    B2_SPRITE_AURA_1,
+    B2_SPRITE_AURA_2,
+    B2_SPRITE_AURA_3,
+
+    // Animação do Boss (BOSS_FRAME_COUNT frames consecutivos)
+    B2_SPRITE_BOSS_FRAME_0,
+    B2_SPRITE_BOSS_FRAME_LAST = B2_SPRITE_BOSS_FRAME_0 + BOSS_FRAME_COUNT - 1,
+
+    // Projéteis do jogador
+    B2_SPRITE_BULLET_WEAK,
+    B2_SPRITE_BULLET_MEDIUM,
+    B2_SPRITE_BULLET_STRONG,
+    B2_SPRITE_BULLET_SHURIKEN,
+
+    // Ícones do HUD e da loja
+    B2_SPRITE_ICON_LIFE,
+    B2_SPRITE_ICON_ENERGY,
+    B2_SPRITE_ICON_SHURIKEN,
+    B2_SPRITE_ICON_SHIELD,
+    B2_SPRITE_ICON_GOLD,
+
+    B2_SPRITE_COUNT
+} B2SpriteId;
+
+// --- ESTRUTURAS DE DADOS ---
+
+/**
+ * @brief Região de um sprite dentro do atlas.
+ */
+typedef struct {
+    int page;           // Página do atlas (-1 se o arquivo não carregou).
+    Rectangle source;   // Sub-retângulo do sprite na página.
+    float width;        // Largura do arquivo original (as escalas e colisões do jogo usam este tamanho).
+    float height;       // Altura do arquivo original.
+} B2Sprite;
+
+/**
+ * @brief Atlas de texturas do Byte Space: todos os sprites de inimigos, Boss, tiros e ícones
+ * empacotados em poucas texturas, para o batch do raylib não quebrar a cada troca de textura.
+ */
+typedef struct {
+    Texture2D pages[B2_ATLAS_MAX_PAGES];
+    int pageFilters[B2_ATLAS_MAX_PAGES];    // TEXTURE_FILTER_POINT (pixel art) ou TEXTURE_FILTER_BILINEAR
+    int pageCount;
+    B2Sprite sprites[B2_SPRITE_COUNT];
+} B2Atlas;
+
+// --- DECLARAÇÕES DE FUNÇÕES PÚBLICAS ---
+
+/**
+ * @brief Carrega as imagens, empacota em prateleiras (shelf packing) e envia as páginas para a GPU.
+ * Só monta na primeira chamada: o atlas fica residente e as próximas visitas ao Byte Space o reaproveitam.
+ */
+void InitB2Atlas(void);
+
+/**
+ * @brief Verifica se o sprite foi carregado e está no atlas.
+ */
+bool IsB2SpriteLoaded(B2SpriteId id);
+
+/**
+ * @brief Desenha um sprite do atlas (mesma semântica de DrawTexturePro, com a origem em coordenadas de destino).
+ */
+void DrawB2Sprite(B2SpriteId id, Rectangle dest, Vector2 origin, float rotation, Color tint);
+
+/**
+ * @brief Descarrega as páginas do atlas (ao fechar o jogo, via ByteSpace_Shutdown).
+ */
+void UnloadB2Atlas(void);
+
+// Atlas global criado no primeiro ByteSpace_Init e usado pelos módulos de desenho.
+extern B2Atlas b2Atlas;
+
+#endif // B2_ATLAS_H
@@ -2,6 +2,7 @@
 #define BULLET_H
 
 #include "raylib.h" // Inclui tipos de dados como Rectangle, Vector2 e Texture2D
+#include "object_pool.h"
 #include <stdbool.h>
 
 // --- CONSTANTES ---
@@ -22,28 +23,24 @@
 typedef struct {
     Rectangle rect;     // Posição e dimensões (usado para colisão e desenho).
     Vector2 speed;      // Vetor de velocidade (dx/dt, dy/dt).
-    bool active;        // Flag para indicar se a bala está em uso ou no pool.
     Color color;        // Cor da bala (pode ser usado para brilho).
     int type;           // Tipo de ataque que gerou a bala (para referência de dano/textura).
 } Bullet;
 
+// Pool das balas (object_pool.h): vivas compactas em bullets.ids.dense, slots estáveis em bullets.items
+DECLARE_OBJECT_POOL(BulletPool, Bullet, MAX_PLAYER_BULLETS)
+
 /**
  * @brief Gerenciador do pool de projéteis do jogador.
  */
 typedef struct BulletManager {
-    Bullet bullets[MAX_PLAYER_BULLETS]; // Array de projéteis (o pool).
-
-    // Texturas dos diferentes tipos de ataque.
-    Texture2D weakTexture;
-    Texture2D mediumTexture;
-    Texture2D strongTexture;
-    Texture2D shurikenTexture;
+    BulletPool bullets;     // Projéteis vivos (cheio, o disparo é descartado e conta em bullets.ids.overflow). Os sprites vêm do b2_atlas.
 } BulletManager;
 
 // --- DECLARAÇÕES DE FUNÇÕES PÚBLICAS ---
 
 /**
- * @brief Inicializa o gerenciador de projéteis, carregando as texturas.
+ * @brief Inicializa o gerenciador de projéteis (os sprites vêm do atlas do Byte Space).
  */
 void InitBulletManager(BulletManager *manager);
 
@@ -67,7 +64,7 @@ void UpdatePlayerBullets(BulletManager *manager, float deltaTime);
 void DrawPlayerBullets(BulletManager *manager);
 
 /**
- * @brief Descarrega as texturas dos projéteis.
+ * @brief Finaliza o gerenciador de projéteis (as texturas pertencem ao atlas).
  */
 void UnloadBulletManager(BulletManager *manager);
 
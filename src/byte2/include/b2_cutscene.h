@@ -3,6 +3,7 @@
 
 #include "raylib.h"
 #include "b2_game_state.h" // Garante que GameState seja conhecido
+#include "b2_input.h"      // Botões do tick (B2Input)
 
 #define MAX_COMIC_PANELS 5
 
@@ -43,7 +44,7 @@ typedef struct {
 // --- FUNÇÕES ---
 void InitCutscene(CutsceneScene *cs);
 void InitEnding(CutsceneScene *cs);
-void UpdateCutscene(CutsceneScene *cs, GameState *state, float dt);
+void UpdateCutscene(CutsceneScene *cs, GameState *state, const B2Input *input, float dt);
 void DrawCutscene(CutsceneScene *cs, int screenWidth, int screenHeight);
 
 #endif // B2_CUTSCENE_H
\ No newline at end of file
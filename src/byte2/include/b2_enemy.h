@@ -3,6 +3,10 @@
 
 #include "raylib.h"
 #include "b2_audio.h" // Necessário para acionar SFX de explosão.
+#include "particles.h" // Sistema de partículas compartilhado com o Guitar Hero.
+#include "b2_grid.h" // Broadphase das colisões tiro x inimigo.
+#include "object_pool.h" // Vivos e explosões da formação.
+#include "b2_formation.h" // Laços vetorizados da marcha.
 
 // --- CONSTANTES DA FORMAÇÃO DE INIMIGOS NORMAIS ---
 #define ENEMY_COLS 11                       // Número de colunas na formação.
@@ -17,9 +21,12 @@
 #define ENEMY_EXPLOSION_DURATION 0.4f       // Duração da animação de explosão.
 #define ENEMY_GAME_OVER_Y 550.0f            // Posição Y que, se atingida, causa Game Over.
 #define ENEMY_GAME_OVER_LINE_Y 550.0f       // Linha de alerta visual (restaurada/reafirmada).
+#define ENEMY_GRID_CELL_SIZE 64.0f          // Lado das células do broadphase (um pouco maior que inimigo + espaçamento).
+#define ENEMY_GRID_MIN_PAIRS 2048           // Tiros x inimigos vivos a partir do qual o grid ganha do laço direto.
+#define ENEMY_AURA_TEXTURE_SIZE 128         // Lado da aura pré-renderizada no atlas (~2x o tamanho na tela).
 
 // --- CONSTANTES DO SISTEMA DE PARTÍCULAS ---
-#define MAX_PARTICLES 500                   // Número máximo de partículas de explosão ativas.
+#define MAX_PARTICLES 2000                  // Máximo de partículas de explosão vivas (cheio, novas são descartadas).
 #define PARTICLE_LIFESPAN 0.8f              // Duração da vida de uma partícula em segundos.
 
 // --- CONSTANTES DO BOSS ---
@@ -31,39 +38,24 @@
 
 // --- ESTRUTURAS DE DADOS ---
 
-/**
- * @brief Representa uma única partícula de explosão.
- */
-typedef struct {
-    Vector2 position;
-    Vector2 velocity;
-    Color color;
-    float life;         // Tempo de vida restante.
-    bool active;
-} Particle;
+#define ENEMY_CAPACITY B2_FORMATION_ROUND(ENEMY_COUNT) // Slots dos arrays da formação (os além de ENEMY_COUNT são enchimento, nunca vivos).
 
 /**
- * @brief Gerenciador do pool de partículas.
+ * @brief Formação de inimigos normais em estrutura de arrays: um array por campo, indexado pelo id
+ * (linha * ENEMY_COLS + coluna). A marcha só lê x, y e live (b2_formation.c).
  */
 typedef struct {
-    Particle particles[MAX_PARTICLES];
-    int nextParticleIndex; // Índice para o próximo slot livre.
-} ParticleManager;
-
-/**
- * @brief Estrutura para um inimigo normal (do tipo grid/formação).
- */
-typedef struct {
-    Vector2 position;
-    Rectangle rect;
-    int type;           // Tipo de inimigo (pode influenciar vida/textura).
-    int health;
-    bool active;
-    float hitTimer;     // Temporizador para o flash de acerto.
-    Color neonColor;    // Cor de néon para o visual.
-    bool isExploding;   // Flag para a animação de explosão.
-    float explosionTimer; // Temporizador da animação de explosão.
-} Enemy;
+    float x[ENEMY_CAPACITY];                // Centro do inimigo.
+    float y[ENEMY_CAPACITY];
+    float live[ENEMY_CAPACITY];             // 1 vivo, 0 morto ou enchimento (máscara dos laços da marcha).
+    float hitTimer[ENEMY_CAPACITY];         // Temporizador para o flash de acerto.
+    float explosionTimer[ENEMY_CAPACITY];   // Temporizador da animação de explosão.
+    int health[ENEMY_CAPACITY];
+    unsigned char type[ENEMY_CAPACITY];     // Tipo de inimigo 1..3 (sprite, aura e vida inicial).
+} EnemyFormation;
+
+// Ids da formação (object_pool.h), para os laços que só passam pelos vivos ou pelas explosões
+DECLARE_ID_POOL(EnemySlots, ENEMY_COUNT)
 
 /**
  * @brief Estrutura para o inimigo Boss.
@@ -90,11 +82,11 @@ typedef struct Boss {
  * @brief Gerenciador principal de todos os inimigos e partículas.
  */
 typedef struct EnemyManager {
-    Enemy enemies[ENEMY_COUNT];     // Array da formação de inimigos normais.
-    Texture2D enemyTextures[3];     // Texturas para diferentes tipos de inimigos.
+    EnemyFormation formation;       // Inimigos normais (estrutura de arrays).
+    EnemySlots alive;               // Inimigos vivos (alive.count é quantos restam na onda; espelha formation.live).
+    EnemySlots exploding;           // Mortos com a animação de explosão ainda na tela.
     float speed;                    // Velocidade horizontal atual.
     int direction;                  // Direção de movimento (+1 direita, -1 esquerda).
-    int activeCount;                // Número de inimigos normais ativos.
     bool gameOver;                  // Flag para indicar Game Over pela invasão.
 
     // Gerenciamento de Ondas
@@ -105,11 +97,11 @@ typedef struct EnemyManager {
     int wavesCompletedCount;        // Contador de ondas completadas.
     bool triggerShopReturn;         // Flag para indicar que o jogador deve retornar à loja.
 
-    ParticleManager particleManager; // Gerenciador de Partículas.
+    ParticleSystem particles;       // Partículas das explosões (particles.c).
+    B2Grid grid;                    // Inimigos ativos por célula (posições postas em dia só quando o grid é consultado).
 
     // Gerenciamento do Boss
     Boss boss;
-    Texture2D bossFrames[BOSS_FRAME_COUNT]; // Texturas de animação do Boss.
     bool bossActive;                        // Flag: O Boss está ativo? (Substituindo a formação normal).
 } EnemyManager;
 
@@ -120,22 +112,32 @@ typedef struct AudioManager AudioManager;
 // --- DECLARAÇÕES DE FUNÇÕES PÚBLICAS ---
 
 /**
- * @brief Inicializa o gerenciador de inimigos, carregando assets e a primeira formação/onda.
+ * @brief Inicializa o gerenciador de inimigos e a primeira formação/onda (os sprites vêm do b2_atlas).
  */
 void InitEnemyManager(EnemyManager *manager, int screenWidth, int screenHeight);
 
 /**
- * @brief Atualiza a lógica de todos os inimigos: movimento, timers, explosões, e verifica invasão.
+ * @brief Atualiza a lógica de todos os inimigos: movimento, timers, e verifica invasão.
  */
 void UpdateEnemies(EnemyManager *manager, float deltaTime, int screenWidth, int *playerLives, bool *gameOver);
 
+/**
+ * @brief Atualiza as partículas das explosões (chamado antes do UpdateEnemies, todo tick de gameplay).
+ */
+void UpdateExplosions(EnemyManager *manager, float deltaTime);
+
 /**
  * @brief Desenha todos os inimigos ativos, o Boss, e as partículas de explosão.
  */
 void DrawEnemies(EnemyManager *manager);
 
 /**
- * @brief Descarrega todas as texturas de inimigos e Boss.
+ * @brief Gera na CPU a aura neon (três anéis) do inimigo do tipo dado, para o atlas (b2_atlas.c).
+ */
+Image GenEnemyAuraImage(int enemyType, int size);
+
+/**
+ * @brief Finaliza o gerenciador de inimigos e libera as partículas e o grid (as texturas pertencem ao atlas).
  */
 void UnloadEnemyManager(EnemyManager *manager);
 
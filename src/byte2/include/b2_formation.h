@@ -0,0 +1,33 @@
+#ifndef B2_FORMATION_H
+#define B2_FORMATION_H
+
+// --- LAÇOS DA FORMAÇÃO (ESTRUTURA DE ARRAYS) ---
+// A marcha da formação de inimigos por tick: a borda (min/max de x dos vivos), o passo de
+// lado, a descida e os timers. Cada campo fica num array de float próprio, indexado pelo id
+// do inimigo, e quem está vivo vem de uma máscara live (1 vivo, 0 morto ou vazio) em vez de
+// um desvio: os laços são retos e o -O2 os vetoriza (SSE/AVX), como os do particles.c.
+// count tem que ser múltiplo de B2_FORMATION_LANES (arrays com B2_FORMATION_ROUND(n) slots,
+// o enchimento com live = 0), para que nenhum laço precise de um resto escalar.
+// Não depende da raylib.
+
+#define B2_FORMATION_LANES 8    // 8 floats = 32 bytes, um registrador AVX
+#define B2_FORMATION_ROUND(n) (((n) + B2_FORMATION_LANES - 1) / B2_FORMATION_LANES * B2_FORMATION_LANES)
+
+// --- DECLARAÇÕES DE FUNÇÕES PÚBLICAS ---
+
+/**
+ * @brief Menor e maior x entre os vivos. Sem nenhum vivo, *minX = FLT_MAX e *maxX = -FLT_MAX.
+ */
+void MeasureB2Formation(const float *x, const float *live, int count, float *minX, float *maxX);
+
+/**
+ * @brief Soma amount aos vivos (x na marcha, y na descida); os mortos ficam onde estão.
+ */
+void ShiftB2Formation(float *values, const float *live, int count, float amount);
+
+/**
+ * @brief Desconta dt de cada timer, parando em 0.
+ */
+void TickB2FormationTimers(float *timers, int count, float dt);
+
+#endif // B2_FORMATION_H
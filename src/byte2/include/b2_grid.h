@@ -0,0 +1,67 @@
+#ifndef B2_GRID_H
+#define B2_GRID_H
+
+#include "raylib.h" // Vector2 e Rectangle (só os tipos; o módulo não chama a raylib)
+#include <stdbool.h>
+
+// --- GRID UNIFORME (BROADPHASE) ---
+// Divide a área do jogo em células quadradas; cada item (um círculo de raio até maxRadius)
+// fica na lista da célula do seu centro. Uma consulta só visita as células que um círculo
+// pode alcançar, então testar N tiros contra M inimigos custa ~N x (vizinhos), não N x M.
+// Mover um item só mexe nas listas quando ele troca de célula (atualização incremental).
+// Itens fora de bounds ficam nas células da borda, sem perder colisões.
+
+// --- ESTRUTURAS DE DADOS ---
+
+/**
+ * @brief Grid de itens identificados por índice (0..capacity-1), em listas duplamente ligadas por célula.
+ */
+typedef struct {
+    Rectangle bounds;   // Área coberta pelas células.
+    float cellSize;
+    float invCellSize;
+    int cols;
+    int rows;
+    float maxRadius;    // Maior raio de item (as consultas crescem por ele).
+
+    int *cellHead;      // Primeiro item de cada célula (-1 = vazia).
+    int *next;          // Próximo item na mesma célula (-1 = fim).
+    int *prev;          // Item anterior na mesma célula (-1 = é o primeiro).
+    int *cellOf;        // Célula de cada item (-1 = fora do grid).
+    int capacity;
+} B2Grid;
+
+// --- DECLARAÇÕES DE FUNÇÕES PÚBLICAS ---
+
+/**
+ * @brief Aloca as células e as listas para até capacity itens. Cada Init pede um UnloadB2Grid.
+ */
+bool InitB2Grid(B2Grid *grid, Rectangle bounds, float cellSize, int capacity, float maxRadius);
+
+/**
+ * @brief Libera a memória do grid.
+ */
+void UnloadB2Grid(B2Grid *grid);
+
+/**
+ * @brief Remove todos os itens.
+ */
+void ClearB2Grid(B2Grid *grid);
+
+/**
+ * @brief Insere o item ou atualiza sua posição (só religa as listas se ele trocar de célula).
+ */
+void MoveB2GridItem(B2Grid *grid, int id, Vector2 position);
+
+/**
+ * @brief Tira o item do grid (nada acontece se ele já estiver fora).
+ */
+void RemoveB2GridItem(B2Grid *grid, int id);
+
+/**
+ * @brief Candidatos a colidir com o círculo: os itens das células que ele (mais maxRadius) alcança.
+ * O teste exato (narrow phase) fica com quem chama. Retorna quantos ids foram escritos em out.
+ */
+int QueryB2Grid(const B2Grid *grid, Vector2 center, float radius, int *out, int maxOut);
+
+#endif // B2_GRID_H
@@ -7,28 +7,19 @@
 // --- ESTRUTURA DE DADOS ---
 
 /**
- * @brief Estrutura que armazena as texturas e o estado básico do HUD.
+ * @brief Estrutura que armazena o estado básico do HUD.
  */
 typedef struct {
     int score; // Pontuação atual do jogo.
 
-    // Ícones de Status
-    Texture2D lifeIconTexture;      // Ícone usado para representar a vida.
-    Texture2D energyIconTexture;    // Ícone usado para a barra de carga/energia.
-
-    // Ícones de Upgrades
-    Texture2D shurikenTexture;      // Ícone para o upgrade Shuriken.
-    Texture2D shieldTexture;        // Ícone para o upgrade Escudo.
-
-    // Ícone de Moeda
-    Texture2D goldTexture;          // Ícone para a moeda (ouro).
+    // Os ícones (vida, energia, upgrades e ouro) ficam no atlas do Byte Space (b2_atlas.h).
 
 } Hud;
 
 // --- DECLARAÇÕES DE FUNÇÕES PÚBLICAS ---
 
 /**
- * @brief Inicializa o HUD, carregando todas as texturas necessárias.
+ * @brief Inicializa o HUD (os ícones vêm do atlas, que precisa ter sido criado antes).
  */
 void InitHud(Hud *hud);
 
@@ -48,11 +39,11 @@ void UpdateHud(Hud *hud, float deltaTime);
  * @param drawLives Vida atual (para desenhar os corações/ícones de vida).
  * @param currentGold Quantidade de ouro atual.
  */
-void DrawHudSide(Hud *hud, bool isLeft, int marginHeight, float energyCharge, bool hasDoubleShot, bool hasShield, int extraLives, int drawLives, int currentGold);
+void DrawHudSide(bool isLeft, int marginHeight, float energyCharge, bool hasDoubleShot, bool hasShield, int extraLives, int drawLives, int currentGold);
 
 
 /**
- * @brief Descarrega todas as texturas do HUD.
+ * @brief Finaliza o HUD (as texturas pertencem ao atlas).
  */
 void UnloadHud(Hud *hud);
 
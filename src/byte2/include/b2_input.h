@@ -0,0 +1,51 @@
+#ifndef B2_INPUT_H
+#define B2_INPUT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// --- ENTRADA POR TICK ---
+// A simulação do Byte Space não lê o teclado: cada tick recebe um B2Input com os botões
+// segurados e as bordas (apertou/soltou) em relação ao tick anterior. Assim a mesma
+// sequência de máscaras reproduz a mesma partida, seja qual for a taxa de quadros.
+
+/**
+ * @brief Botões do jogo, um bit cada.
+ */
+typedef enum {
+    B2_BUTTON_LEFT    = 1 << 0,   // Seta esquerda
+    B2_BUTTON_RIGHT   = 1 << 1,   // Seta direita
+    B2_BUTTON_UP      = 1 << 2,   // Seta para cima
+    B2_BUTTON_DOWN    = 1 << 3,   // Seta para baixo
+    B2_BUTTON_FIRE    = 1 << 4,   // Espaço: carrega e dispara (também pula a intro)
+    B2_BUTTON_BUY     = 1 << 5,   // E: compra na loja / vai para a loja
+    B2_BUTTON_SKIP    = 1 << 6,   // F: pula a loja entre ondas
+    B2_BUTTON_PORTAL  = 1 << 7,   // P: sai da loja pelo portal
+    B2_BUTTON_NEXT    = 1 << 8,   // Z: próxima página do final
+    B2_BUTTON_CONFIRM = 1 << 9    // Enter: pula a intro / sai no Game Over e no final
+} B2Button;
+
+/**
+ * @brief Estado dos botões em um tick da simulação.
+ */
+typedef struct {
+    uint16_t held;      // Segurados neste tick.
+    uint16_t pressed;   // Apertados neste tick (não estavam no anterior).
+    uint16_t released;  // Soltos neste tick (estavam no anterior).
+} B2Input;
+
+/**
+ * @brief Lê o teclado. Em taps recebe as teclas apertadas neste quadro mesmo que já soltas.
+ */
+uint16_t ReadB2Buttons(uint16_t *taps);
+
+/**
+ * @brief Monta a entrada do tick a partir dos botões do tick anterior e dos atuais.
+ */
+B2Input MakeB2Input(uint16_t previousHeld, uint16_t held);
+
+static inline bool IsB2ButtonDown(const B2Input *input, B2Button button) { return (input->held & button) != 0; }
+static inline bool IsB2ButtonPressed(const B2Input *input, B2Button button) { return (input->pressed & button) != 0; }
+static inline bool IsB2ButtonReleased(const B2Input *input, B2Button button) { return (input->released & button) != 0; }
+
+#endif // B2_INPUT_H
@@ -5,6 +5,7 @@
 #include "b2_bullet.h" // Necessário para interagir com o sistema de projéteis
 #include "b2_hud.h"    // Necessário para interagir com a interface do usuário (ex: barra de energia)
 #include "b2_audio.h"
+#include "b2_input.h"  // Botões do tick (B2Input)
 // A struct AudioManager é declarada aqui, mas definida em outro arquivo.
 // Isso permite usar o tipo 'AudioManager*' nas funções sem incluir o arquivo 'audio.h' inteiro.
 typedef struct AudioManager AudioManager;
@@ -12,6 +13,10 @@ typedef struct AudioManager AudioManager;
 // --- CONSTANTES ---
 
 #define PLAYER_SCALE 0.2f // Fator de escala da textura da nave do jogador
+// Tamanho dos PNGs da nave (byte_1/2/4.png e byte_shield.png, todos iguais). O tamanho da nave
+// na simulação sai daqui, não da textura: a simulação headless roda sem texturas
+#define PLAYER_SPRITE_WIDTH 1152.0f
+#define PLAYER_SPRITE_HEIGHT 896.0f
 #define ATTACK_WEAK 1     // Tipo de ataque 1: Fraco
 #define ATTACK_MEDIUM 2   // Tipo de ataque 2: Médio
 #define ATTACK_STRONG 3   // Tipo de ataque 3: Forte (Carregado ao máximo)
@@ -28,6 +33,7 @@ typedef struct {
     Vector2 position;                   // Posição (x, y) na tela (geralmente o centro da nave)
     float speed;                        // Velocidade de movimento
     float scale;                        // Escala de desenho (deve ser igual a PLAYER_SCALE)
+    Vector2 size;                       // Tamanho da nave na simulação (PLAYER_SPRITE_* x scale)
 
     // --- Economia e Recursos ---
     int gold;                           // Moeda do jogo (coletada/gasta na loja)
@@ -60,8 +66,8 @@ typedef struct {
 void InitPlayer(Player *player);
 
 // Atualiza a lógica do jogador: movimento, carregamento de ataque, disparo, checagem de HUD.
-// Requer o Player, Gerenciador de Balas, Gerenciador de Áudio, HUD, delta time e dimensões da tela.
-void UpdatePlayer(Player *player, BulletManager *bulletManager, AudioManager *audioManager, Hud *hud, float deltaTime, int screenWidth, int screenHeight);
+// Requer o Player, Gerenciador de Balas, Gerenciador de Áudio, HUD, botões do tick, delta time e dimensões da tela.
+void UpdatePlayer(Player *player, BulletManager *bulletManager, AudioManager *audioManager, Hud *hud, const B2Input *input, float deltaTime, int screenWidth, int screenHeight);
 
 // Desenha a nave do jogador e quaisquer efeitos visuais (aura/escudo).
 void DrawPlayer(Player *player);
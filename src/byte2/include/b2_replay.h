@@ -0,0 +1,99 @@
+#ifndef B2_REPLAY_H
+#define B2_REPLAY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// --- REPLAY DE ENTRADA (.b2r) ---
+// Como a simulação do Byte Space é determinística (passo fixo, B2Input por tick e b2_rng),
+// a semente mais os botões de cada tick bastam para refazer a partida inteira. O arquivo:
+//   [B2ReplayHeader][B2ReplayRun x runCount]
+// Os botões são gravados em corridas (RLE): cada B2ReplayRun diz "estes botões por length
+// ticks". Segurar uma direção por 2 s a 120 Hz custa 4 bytes, e uma partida de 10 ondas
+// fica em poucos KB. finalHash é o hash do estado depois do último tick: o replay que
+// chegar a outro hash divergiu (serve de teste de regressão). Campos little-endian.
+#define B2_REPLAY_MAGIC "B2RP"
+#define B2_REPLAY_VERSION 1
+#define B2_REPLAY_FILE "byte2_last.b2r"    // Última partida jogada (gravada no ByteSpace_Unload)
+
+typedef struct {
+    char magic[4];          // "B2RP"
+    uint32_t version;
+    uint32_t tickRate;      // Ticks por segundo da gravação (B2_TICK_RATE)
+    uint32_t seed;          // Semente do b2_rng
+    uint32_t tickCount;
+    uint32_t runCount;
+    uint64_t finalHash;     // Hash do estado depois do último tick (0 = não calculado)
+} B2ReplayHeader;
+
+typedef struct {
+    uint16_t buttons;       // Máscara de B2Button
+    uint16_t length;        // Ticks seguidos com esses botões (1..65535)
+} B2ReplayRun;
+
+/**
+ * @brief Entrada de uma partida, gravando ou tocando.
+ */
+typedef struct {
+    uint32_t tickRate;
+    uint32_t seed;
+    uint32_t tickCount;
+    uint64_t finalHash;
+
+    B2ReplayRun *runs;
+    int runCount;
+    int runCapacity;
+    bool failed;            // Gravação incompleta (faltou memória): não salvar, não refaria a partida
+
+    // Posição da leitura
+    int cursorRun;
+    int cursorTick;         // Ticks já lidos da corrida atual
+} B2Replay;
+
+// --- DECLARAÇÕES DE FUNÇÕES PÚBLICAS ---
+
+/**
+ * @brief Começa uma gravação vazia (libera a anterior, se houver).
+ */
+void BeginB2Recording(B2Replay *replay, uint32_t seed, uint32_t tickRate);
+
+/**
+ * @brief Acrescenta os botões de um tick (estende a última corrida quando são os mesmos).
+ * Sem memória para uma corrida nova, marca failed e ignora os ticks seguintes.
+ */
+void RecordB2Tick(B2Replay *replay, uint16_t buttons);
+
+/**
+ * @brief Grava o replay em disco (via arquivo temporário). Retorna false se não conseguiu.
+ */
+bool SaveB2Replay(const B2Replay *replay, const char *path);
+
+/**
+ * @brief Lê e valida um replay, já posicionado no primeiro tick.
+ * Libera o conteúdo anterior: replay tem que vir zerado ({ 0 }) ou de um uso anterior.
+ */
+bool LoadB2Replay(B2Replay *replay, const char *path);
+
+/**
+ * @brief Volta a leitura para o primeiro tick.
+ */
+void RewindB2Replay(B2Replay *replay);
+
+/**
+ * @brief Botões do próximo tick. Retorna false quando o replay acabou.
+ */
+bool NextB2ReplayTick(B2Replay *replay, uint16_t *buttons);
+
+/**
+ * @brief Libera as corridas.
+ */
+void UnloadB2Replay(B2Replay *replay);
+
+/**
+ * @brief Mistura bytes num hash FNV-1a 64 (comece com B2_HASH_SEED). Usado no hash do estado.
+ */
+#define B2_HASH_SEED 0xcbf29ce484222325ull
+uint64_t HashB2Bytes(uint64_t hash, const void *data, size_t size);
+
+#endif // B2_REPLAY_H
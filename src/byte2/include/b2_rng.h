@@ -0,0 +1,27 @@
+#ifndef B2_RNG_H
+#define B2_RNG_H
+
+#include <stdint.h>
+
+// --- GERADOR ALEATÓRIO DA SIMULAÇÃO ---
+// Substitui o GetRandomValue da raylib em tudo o que a simulação do Byte Space sorteia
+// (partículas, cores de explosão). Com a mesma semente e as mesmas entradas por tick, a
+// partida se repete igual, em qualquer taxa de quadros. Efeitos só de tela (estrelas de
+// fundo) continuam no gerador da raylib.
+
+/**
+ * @brief Reinicia o gerador com a semente dada (o ByteSpace_Init semeia a cada partida).
+ */
+void SeedB2Rng(uint32_t seed);
+
+/**
+ * @brief Semente usada no último SeedB2Rng.
+ */
+uint32_t GetB2RngSeed(void);
+
+/**
+ * @brief Inteiro sorteado em [min, max] (mesma semântica do GetRandomValue).
+ */
+int GetB2RandomValue(int min, int max);
+
+#endif // B2_RNG_H
@@ -5,6 +5,7 @@
 #include "b2_player.h"     // Necessário para acessar e modificar o estado do jogador
 #include "b2_star.h"       // Necessário para desenhar e atualizar o campo estelar de fundo
 #include "b2_game_state.h" // Necessário para transição de estados (e.g., sair da loja)
+#include "b2_atlas.h"      // Ícones dos itens (B2SpriteId)
 
 // --- CONSTANTES E ENUMS DE ITENS ---
 
@@ -49,7 +50,7 @@ typedef struct {
 typedef struct {
     Vendor vendor;                              // Estrutura do Vendedor
     ShopItem items[MAX_SHOP_ITEMS];             // Array de itens disponíveis
-    Texture2D itemTextures[MAX_SHOP_ITEMS];     // Texturas dos ícones dos itens (para desenho)
+    B2SpriteId itemSprites[MAX_SHOP_ITEMS];     // Ícones dos itens no atlas do Byte Space (para desenho)
 
     Rectangle exitArea;                         // Área de colisão para sair da loja (e.g., um portal)
 
@@ -69,13 +70,13 @@ typedef struct {
 void InitShop(ShopScene *shop, Player *player, int gameWidth, int gameHeight);
 
 // Atualiza a lógica da loja: movimento do jogador, verificação de interação (compra/saída)
-// e atualização do fundo estelar.
-void UpdateShop(ShopScene *shop, Player *player, StarField *stars, GameState *state, float deltaTime);
+// e atualização do fundo estelar. Os botões vêm do tick (B2Input), não do teclado.
+void UpdateShop(ShopScene *shop, Player *player, StarField *stars, GameState *state, const B2Input *input, float deltaTime);
 
 // Desenha todos os elementos da cena da loja: vendedor, itens, texto, fundo.
 void DrawShop(ShopScene *shop, Player *player, StarField *stars);
 
-// Descarrega texturas e libera recursos da loja.
+// Libera recursos da loja (os ícones pertencem ao atlas).
 void UnloadShop(ShopScene *shop);
 
 #endif // SHOP_H
\ No newline at end of file
@@ -0,0 +1,86 @@
+#ifndef B2_SIM_H
+#define B2_SIM_H
+
+#include "b2_player.h"      // Player (e, por ele, BulletManager, Hud, AudioManager e B2Input)
+#include "b2_enemy.h"
+#include "b2_shop.h"
+#include "b2_cutscene.h"
+#include "b2_star.h"
+#include "b2_game_state.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// --- SIMULAÇÃO DO BYTE SPACE ---
+// Todo o estado da partida (cena, jogador, tiros, inimigos, loja, cutscenes) e o tick de
+// passo fixo, separados do desenho: o byte2.c cria a janela, lê o teclado, interpola e
+// desenha a partir daqui; o tools/b2_headless roda o mesmo tick sem janela nem áudio.
+// O tamanho das coisas na simulação vem de constantes (PLAYER_SPRITE_*, BULLET_SPRITE_SIZE),
+// nunca das texturas, e sem janela/dispositivo de áudio o asset_cache devolve texturas e
+// sons vazios, que os módulos já tratam como arquivo ausente.
+
+#define B2_GAME_WIDTH 800
+#define B2_GAME_HEIGHT 600
+#define B2_STAR_COUNT 150
+#define B2_TICK_RATE 120
+#define B2_TICK_DT (1.0f / B2_TICK_RATE)
+
+/**
+ * @brief Sistemas medidos separadamente no tick (B2SimTimings).
+ */
+typedef enum {
+    B2_SYSTEM_SCENES,       // Cutscenes, loja, estrelas, HUD e transições de estado
+    B2_SYSTEM_PLAYER,
+    B2_SYSTEM_BULLETS,
+    B2_SYSTEM_ENEMIES,      // Formação, Boss, ondas (inclui a atualização do grid)
+    B2_SYSTEM_PARTICLES,
+    B2_SYSTEM_COLLISION,    // Tiros x inimigos (inclui a emissão das explosões)
+    B2_SYSTEM_COUNT
+} B2System;
+
+typedef struct {
+    double seconds[B2_SYSTEM_COUNT];
+    uint64_t ticks;
+} B2SimTimings;
+
+/**
+ * @brief Estado completo de uma partida.
+ */
+typedef struct {
+    GameState state;
+    bool shouldExit;                // Jogador saiu (Enter no Game Over ou no final).
+
+    StarField starField;            // Fundo da loja e do gameplay.
+    Player player;
+    Hud hud;
+    BulletManager bulletManager;
+    EnemyManager enemyManager;
+    ShopScene shop;
+    CutsceneScene cutscene;
+
+    double (*clock)(void);          // Relógio em segundos para medir os sistemas (NULL = sem medição).
+    B2SimTimings timings;
+} B2Sim;
+
+// --- DECLARAÇÕES DE FUNÇÕES PÚBLICAS ---
+
+/**
+ * @brief Começa uma partida na intro. Semeie o b2_rng antes (SeedB2Rng) para uma partida reproduzível.
+ */
+void InitB2Sim(B2Sim *sim);
+
+/**
+ * @brief Avança um tick de dt (B2_TICK_DT no jogo) com os botões do tick. Não lê teclado nem relógio.
+ */
+void StepB2Sim(B2Sim *sim, const B2Input *input, float dt);
+
+/**
+ * @brief Hash do estado (posições, vidas, ouro, onda, tiros, partículas), para comparar partidas.
+ */
+uint64_t HashB2Sim(const B2Sim *sim);
+
+/**
+ * @brief Libera o que a partida alocou (partículas, grid, texturas do jogador).
+ */
+void UnloadB2Sim(B2Sim *sim);
+
+#endif // B2_SIM_H
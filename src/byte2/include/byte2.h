@@ -5,6 +5,10 @@
 
 // Inicializa o minigame Byte Space
 // Retorna true se carregou com sucesso
+// Cada partida é gravada em byte2_last.b2r ao sair (ver b2_replay.h). Para repeti-la:
+//   BYTE2_REPLAY=byte2_last.b2r        toca o replay em tempo real, no lugar do teclado
+//   BYTE2_REPLAY_FAST=1 (junto)        o mais rápido possível, sem desenhar nem som, e
+//                                      mostra ticks/s e se o estado final bateu com o gravado
 bool ByteSpace_Init(int width, int height);
 
 // Atualiza e desenha o frame
@@ -13,6 +17,10 @@ bool ByteSpace_Init(int width, int height);
 bool ByteSpace_UpdateDraw(float dt);
 
 // Descarrega texturas e sons para liberar memória
+// (o atlas de sprites continua residente para a próxima visita)
 void ByteSpace_Unload(void);
 
+// Libera o que fica residente entre visitas (atlas); chamar uma vez ao fechar o jogo
+void ByteSpace_Shutdown(void);
+
 #endif // BYTE2_H
\ No newline at end of file
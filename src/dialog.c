@@ -1,4 +1,5 @@
 #include "dialog.h"
+#include "asset_cache.h"
 #include <string.h>
 
 void Dialog_Init(Dialog *d) {
@@ -17,7 +18,7 @@ void Dialog_Init(Dialog *d) {
         GetScreenWidth() - 80,
         120
     };
-    d->sfxMorse = LoadSound("assets/audio/morse.mp3");
+    d->sfxMorse = AssetCache_LoadSound("assets/audio/morse.mp3");
     SetSoundVolume(d->sfxMorse, 0.5f);
 
 }
@@ -124,5 +125,5 @@ void Dialog_DrawTemporary(Dialog *d) {
     DrawText(d->lines[0], d->box.x + 20, d->box.y + 20, 28, WHITE);
 }
 void Dialog_Unload(Dialog *d) {
-    UnloadSound(d->sfxMorse);
+    AssetCache_UnloadSound(d->sfxMorse);
 }
@@ -3,6 +3,7 @@
 #include <stdio.h>
 #include <math.h>
 #include "dialog.h"
+#include "asset_cache.h"
 
 // --- DEFINIÇÕES ---
 typedef enum {
@@ -112,12 +113,12 @@ bool Game_Init(int width, int height) {
     // -------------------------
     //   PLAYER
     // -------------------------
-    player.animIdle.texture = LoadTexture("assets/tiles/player/idle/idle.png");
+    player.animIdle.texture = AssetCache_LoadTexture("assets/tiles/player/idle/idle.png");
     player.animIdle.cols = SPRITE_COLS;
     player.animIdle.rows = SPRITE_ROWS;
     player.animIdle.frameTime = 0.2f;
 
-    player.animWalk.texture = LoadTexture("assets/tiles/player/walk/walk.png");
+    player.animWalk.texture = AssetCache_LoadTexture("assets/tiles/player/walk/walk.png");
     player.animWalk.cols = SPRITE_COLS;
     player.animWalk.rows = SPRITE_ROWS;
     player.animWalk.frameTime = FRAME_TIME;
@@ -136,15 +137,15 @@ bool Game_Init(int width, int height) {
     float aScale = ARCADE_SCALE;
 
     // 🎮 ARCADE 0 — Guitar Hero
-    arcades[0].texFixed   = LoadTexture("assets/arcades/fliperama_guitarhero.png");
-    arcades[0].texBroken  = LoadTexture("assets/arcades/fliperama_quebrado_guitarhero.png");
+    arcades[0].texFixed   = AssetCache_LoadTexture("assets/arcades/fliperama_guitarhero.png");
+    arcades[0].texBroken  = AssetCache_LoadTexture("assets/arcades/fliperama_quebrado_guitarhero.png");
     arcades[0].position   = (Vector2){ spacing*1 - (arcades[0].texFixed.width * aScale)/2.0f, 60 };
     arcades[0].texCurrent = arcades[0].texFixed;
     arcades[0].canEnter   = true;
 
     // 🎮 ARCADE 1 — ByteSpace
-    arcades[1].texFixed   = LoadTexture("assets/arcades/fliperama_byte.png");
-    arcades[1].texBroken  = LoadTexture("assets/arcades/fliperama_quebrado_byte.png");
+    arcades[1].texFixed   = AssetCache_LoadTexture("assets/arcades/fliperama_byte.png");
+    arcades[1].texBroken  = AssetCache_LoadTexture("assets/arcades/fliperama_quebrado_byte.png");
     arcades[1].position   = (Vector2){ spacing*2 - (arcades[1].texFixed.width * aScale)/2.0f, 60 };
     if (level1Completed) {
         arcades[1].texCurrent = arcades[1].texFixed;
@@ -155,8 +156,8 @@ bool Game_Init(int width, int height) {
     }
 
     // 🎮 ARCADE 2 — Insert
-    arcades[2].texFixed   = LoadTexture("assets/arcades/fliperama_insert.png");
-    arcades[2].texBroken  = LoadTexture("assets/arcades/fliperama_quebrado_insert.png");
+    arcades[2].texFixed   = AssetCache_LoadTexture("assets/arcades/fliperama_insert.png");
+    arcades[2].texBroken  = AssetCache_LoadTexture("assets/arcades/fliperama_quebrado_insert.png");
     arcades[2].position   = (Vector2){ spacing*3 - (arcades[2].texFixed.width * aScale)/2.0f, 60 };
     if (level2Completed) {
         arcades[2].texCurrent = arcades[2].texFixed;
@@ -379,12 +380,12 @@ int Game_UpdateDraw(float dt) {
 // --- UNLOAD ---
 void Game_Unload(void) {
     Dialog_Unload(&dialog);
-    UnloadTexture(player.animIdle.texture);
-    UnloadTexture(player.animWalk.texture);
+    AssetCache_UnloadTexture(player.animIdle.texture);
+    AssetCache_UnloadTexture(player.animWalk.texture);
 
     for (int i = 0; i < NUM_ARCADES; i++) {
-        UnloadTexture(arcades[i].texBroken);
-        UnloadTexture(arcades[i].texFixed);
+        AssetCache_UnloadTexture(arcades[i].texBroken);
+        AssetCache_UnloadTexture(arcades[i].texFixed);
     }
 }
 
@@ -0,0 +1,188 @@
+#include "gh_calibration.h"
+#include "gh_input.h"
+#include "raylib.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define CLICK_SAMPLE_RATE 44100
+#define CLICK_SECONDS 0.03f
+#define CLICK_FREQUENCY 1500.0f
+
+typedef enum { CAL_AUDIO, CAL_VIDEO, CAL_DONE } CalPhase;
+
+static CalPhase phase = CAL_DONE;
+static double phaseStart = 0.0;
+static double beatTimes[GH_CAL_BEATS];     // GetTime() em que cada batida saiu de fato
+static int beatsFired = 0;
+static double taps[GH_CAL_BEATS * 4];
+static int tapCount = 0;
+static float measured[2] = { 0 };          // Mediana de cada rodada (segundos)
+static bool measuredOk[2] = { false };
+static double lastFlash = -1.0;
+
+static Sound click = {0};
+static bool haveClick = false;
+
+// --- ARQUIVO ---
+bool GhLatency_Load(GhLatency *latency) {
+    latency->inputLatency = 0.0f;
+    latency->outputLatency = 0.0f;
+
+    FILE *f = fopen(GH_CALIBRATION_FILE, "r");
+    if (!f) return false;
+    float inputMs = 0.0f, outputMs = 0.0f;
+    bool ok = fscanf(f, "input_ms=%f output_ms=%f", &inputMs, &outputMs) == 2;
+    fclose(f);
+    if (!ok) {
+        printf("AVISO: %s invalido, usando latencia zero.\n", GH_CALIBRATION_FILE);
+        return false;
+    }
+    latency->inputLatency = inputMs / 1000.0f;
+    latency->outputLatency = outputMs / 1000.0f;
+    return true;
+}
+
+void GhLatency_Save(const GhLatency *latency) {
+    FILE *f = fopen(GH_CALIBRATION_FILE, "w");
+    if (!f) {
+        printf("AVISO: Nao foi possivel gravar %s.\n", GH_CALIBRATION_FILE);
+        return;
+    }
+    fprintf(f, "input_ms=%.1f\noutput_ms=%.1f\n", latency->inputLatency * 1000.0f, latency->outputLatency * 1000.0f);
+    fclose(f);
+}
+
+// --- AUXILIARES ---
+// Clique curto gerado em memória (seno com decaimento), para não depender de asset
+static void LoadClick(void) {
+    if (haveClick || !IsAudioDeviceReady()) return;
+
+    unsigned int frames = (unsigned int)(CLICK_SAMPLE_RATE * CLICK_SECONDS);
+    short *samples = (short *)malloc(frames * sizeof(short));
+    if (!samples) return;
+    for (unsigned int i = 0; i < frames; i++) {
+        float t = (float)i / CLICK_SAMPLE_RATE;
+        samples[i] = (short)(28000.0f * sinf(2.0f * PI * CLICK_FREQUENCY * t) * expf(-t * 150.0f));
+    }
+
+    Wave wave = { frames, CLICK_SAMPLE_RATE, 16, 1, samples };
+    click = LoadSoundFromWave(wave);
+    UnloadWave(wave);
+    haveClick = true;
+}
+
+static int CompareDouble(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x < y) ? -1 : (x > y);
+}
+
+// Mediana dos desvios toque - batida mais próxima (ignorando o aquecimento)
+static bool MeasureRound(float *result) {
+    double offsets[GH_CAL_BEATS * 4];
+    int count = 0;
+    for (int t = 0; t < tapCount; t++) {
+        int best = -1;
+        double bestDiff = GH_CAL_MATCH_SECONDS;
+        for (int b = 0; b < beatsFired; b++) {
+            double diff = fabs(taps[t] - beatTimes[b]);
+            if (diff < bestDiff) { bestDiff = diff; best = b; }
+        }
+        if (best >= GH_CAL_WARMUP_BEATS) offsets[count++] = taps[t] - beatTimes[best];
+    }
+    if (count < GH_CAL_MIN_TAPS) return false;
+
+    qsort(offsets, count, sizeof(double), CompareDouble);
+    *result = (float)((count % 2) ? offsets[count / 2] : 0.5 * (offsets[count / 2 - 1] + offsets[count / 2]));
+    return true;
+}
+
+static void StartRound(CalPhase next) {
+    phase = next;
+    phaseStart = GetTime() + 1.0; // Um segundo para se preparar
+    beatsFired = 0;
+    tapCount = 0;
+    lastFlash = -1.0;
+}
+
+// --- API ---
+void GhCalibration_Begin(void) {
+    LoadClick();
+    measuredOk[0] = measuredOk[1] = false;
+    StartRound(haveClick ? CAL_AUDIO : CAL_VIDEO);
+}
+
+void GhCalibration_Update(GhLatency *latency) {
+    if (phase == CAL_DONE) return;
+    double now = GetTime();
+
+    // Batidas no horário (a batida registra o instante em que realmente saiu)
+    while (beatsFired < GH_CAL_BEATS && now >= phaseStart + beatsFired * GH_CAL_BEAT_SECONDS) {
+        beatTimes[beatsFired++] = now;
+        if (phase == CAL_AUDIO) PlaySound(click);
+        else lastFlash = now;
+    }
+
+    // Toques com o carimbo de tempo do gh_input (qualquer fret)
+    GhInputEvent event;
+    while (GhInput_NextEvent(&event)) {
+        if (event.down && tapCount < GH_CAL_BEATS * 4) taps[tapCount++] = event.wallTime;
+    }
+
+    double roundEnd = phaseStart + (GH_CAL_BEATS - 1) * GH_CAL_BEAT_SECONDS + GH_CAL_MATCH_SECONDS;
+    if (now < roundEnd) return;
+
+    int round = (phase == CAL_AUDIO) ? 0 : 1;
+    measuredOk[round] = MeasureRound(&measured[round]);
+    if (phase == CAL_AUDIO) {
+        StartRound(CAL_VIDEO);
+        return;
+    }
+
+    // Entrada = rodada de vídeo; saída de áudio = rodada de áudio - entrada
+    phase = CAL_DONE;
+    if (measuredOk[1]) latency->inputLatency = measured[1];
+    if (measuredOk[0] && measuredOk[1]) {
+        float output = measured[0] - measured[1];
+        latency->outputLatency = (output < 0.0f) ? 0.0f : output;
+    }
+    printf("GuitarHero: calibracao (rodada audio %.1f ms, rodada video %.1f ms) -> entrada %.1f ms, saida %.1f ms\n",
+           measuredOk[0] ? measured[0] * 1000.0f : 0.0f, measuredOk[1] ? measured[1] * 1000.0f : 0.0f,
+           latency->inputLatency * 1000.0f, latency->outputLatency * 1000.0f);
+}
+
+void GhCalibration_Draw(int screenW, int screenH, float hitZoneY) {
+    DrawRectangle(0, 0, screenW, screenH, Fade(BLACK, 0.8f));
+
+    const char *title = "CALIBRATION";
+    DrawText(title, screenW/2 - MeasureText(title, 60)/2, 150, 60, (Color){ 0, 243, 255, 255 });
+
+    if (phase == CAL_DONE) {
+        const char *in = measuredOk[1] ? TextFormat("VIDEO/INPUT: %.0f ms", measured[1] * 1000.0f) : "VIDEO/INPUT: NOT ENOUGH TAPS";
+        const char *out = (measuredOk[0] && measuredOk[1]) ? TextFormat("AUDIO: %.0f ms", (measured[0] - measured[1]) * 1000.0f) : "AUDIO: NOT ENOUGH TAPS";
+        DrawText(in, screenW/2 - MeasureText(in, 30)/2, screenH/2 - 40, 30, WHITE);
+        DrawText(out, screenW/2 - MeasureText(out, 30)/2, screenH/2, 30, WHITE);
+        const char *exitMsg = "PRESS [ENTER] TO SAVE";
+        DrawText(exitMsg, screenW/2 - MeasureText(exitMsg, 30)/2, screenH - 150, 30, (Color){ 255, 0, 110, 255 });
+        return;
+    }
+
+    const char *hint = (phase == CAL_AUDIO) ? "TAP ANY FRET ON EACH CLICK" : "TAP ANY FRET ON EACH FLASH";
+    DrawText(hint, screenW/2 - MeasureText(hint, 30)/2, 250, 30, WHITE);
+    DrawText(TextFormat("%d / %d", beatsFired, GH_CAL_BEATS), screenW/2 - 30, 300, 30, GRAY);
+
+    // Flash da rodada de vídeo na altura da linha de acerto
+    float flash = (lastFlash > 0.0) ? 1.0f - (float)(GetTime() - lastFlash) / 0.15f : 0.0f;
+    DrawCircleLines(screenW/2, (int)hitZoneY, 40, WHITE);
+    if (flash > 0.0f) DrawCircle(screenW/2, (int)hitZoneY, 38, Fade(WHITE, flash));
+}
+
+bool GhCalibration_IsDone(void) {
+    return phase == CAL_DONE;
+}
+
+void GhCalibration_Unload(void) {
+    if (haveClick) UnloadSound(click);
+    haveClick = false;
+    phase = CAL_DONE;
+}
@@ -0,0 +1,36 @@
+#ifndef GH_CALIBRATION_H
+#define GH_CALIBRATION_H
+
+#include <stdbool.h>
+
+// --- CALIBRAÇÃO DE LATÊNCIA DO GUITAR HERO ---
+// Duas rodadas de toques no ritmo (qualquer fret):
+//   1. ÁUDIO: só cliques sonoros -> mede saída de áudio + entrada
+//   2. VÍDEO: só um flash na tela -> mede entrada (incluindo a tela)
+// A saída de áudio é a diferença entre as duas. Os valores ficam salvos em
+// GH_CALIBRATION_FILE e são aplicados ao julgamento e ao desenho das notas.
+
+#define GH_CALIBRATION_FILE "guitar_calibration.cfg"
+#define GH_CAL_BEATS 16
+#define GH_CAL_WARMUP_BEATS 4           // Primeiras batidas só para pegar o ritmo
+#define GH_CAL_BEAT_SECONDS 0.6
+#define GH_CAL_MATCH_SECONDS 0.25       // Toque mais longe que isso da batida é ignorado
+#define GH_CAL_MIN_TAPS 4
+
+typedef struct {
+    float inputLatency;     // Segundos entre ver/ouvir e o toque chegar ao jogo
+    float outputLatency;    // Segundos entre o relógio do áudio e o som sair
+} GhLatency;
+
+// Lê/grava os valores salvos (Load devolve false e zera se não houver arquivo)
+bool GhLatency_Load(GhLatency *latency);
+void GhLatency_Save(const GhLatency *latency);
+
+// Tela de calibração: Begin prepara o clique; Update consome os toques do gh_input
+void GhCalibration_Begin(void);
+void GhCalibration_Update(GhLatency *latency);
+void GhCalibration_Draw(int screenW, int screenH, float hitZoneY);
+bool GhCalibration_IsDone(void);
+void GhCalibration_Unload(void);
+
+#endif // GH_CALIBRATION_H
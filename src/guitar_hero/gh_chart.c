@@ -0,0 +1,227 @@
+#include "gh_chart.h"
+#include "gh_midi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+// O layout em disco depende destes tamanhos (header alinhado em 8, notas em 4)
+typedef char GhChartHeaderSizeCheck[(sizeof(GhChartHeader) == 64) ? 1 : -1];
+typedef char GhChartNoteSizeCheck[(sizeof(GhChartNote) == 12) ? 1 : -1];
+
+// --- AUXILIARES ---
+static uint64_t HashBytes(const unsigned char *data, size_t size) {
+    uint64_t hash = 0xcbf29ce484222325ull; // FNV-1a 64
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+static int64_t FileMtime(const char *path) {
+    struct stat st;
+    return (stat(path, &st) == 0) ? (int64_t)st.st_mtime : 0;
+}
+
+bool GhChart_CachePath(const char *midiPath, char *out, int outSize) {
+    const char *dot = strrchr(midiPath, '.');
+    const char *slash = strrchr(midiPath, '/');
+    int baseLength = (dot && (!slash || dot > slash)) ? (int)(dot - midiPath) : (int)strlen(midiPath);
+    int length = snprintf(out, (size_t)outSize, "%.*s.ghc", baseLength, midiPath);
+    return length >= 0 && length < outSize;
+}
+
+static size_t ChartBytes(uint32_t noteCount) {
+    return sizeof(GhChartHeader) + (size_t)noteCount * (sizeof(GhChartNote) + sizeof(uint32_t));
+}
+
+// Aponta o chart para um bloco [header][notas][laneIndex] já validado
+static void BindChart(GhChart *chart, const unsigned char *blob) {
+    const GhChartHeader *header = (const GhChartHeader *)blob;
+    chart->notes = (const GhChartNote *)(blob + sizeof(GhChartHeader));
+    chart->laneIndex = (const uint32_t *)(chart->notes + header->noteCount);
+    chart->noteCount = header->noteCount;
+    memcpy(chart->fretOffset, header->fretOffset, sizeof(chart->fretOffset));
+    chart->lastNoteTime = header->lastNoteTime;
+}
+
+// --- CACHE ---
+static bool OpenCache(GhChart *chart, const char *cachePath, const GhChartHeader *expected) {
+    if (!MappedFile_Open(&chart->file, cachePath)) return false;
+
+    const GhChartHeader *header = (const GhChartHeader *)chart->file.data;
+    bool valid = chart->file.size >= sizeof(GhChartHeader) &&
+                 memcmp(header->magic, GH_CHART_MAGIC, 4) == 0 &&
+                 header->version == GH_CHART_VERSION &&
+                 header->sourceSize == expected->sourceSize &&
+                 header->sourceMtime == expected->sourceMtime &&
+                 header->sourceHash == expected->sourceHash &&
+                 chart->file.size == ChartBytes(header->noteCount) &&
+                 header->fretOffset[0] == 0 &&
+                 header->fretOffset[GH_CHART_FRETS] == header->noteCount;
+
+    for (int f = 0; valid && f < GH_CHART_FRETS; f++) {
+        if (header->fretOffset[f] > header->fretOffset[f + 1]) valid = false;
+    }
+
+    if (valid) {
+        BindChart(chart, chart->file.data);
+        for (uint32_t i = 0; i < chart->noteCount; i++) {
+            if (chart->laneIndex[i] >= chart->noteCount) { valid = false; break; }
+        }
+    }
+
+    if (!valid) {
+        MappedFile_Close(&chart->file);
+        memset(chart, 0, sizeof(*chart));
+        return false;
+    }
+    return true;
+}
+
+static void WriteCache(const char *cachePath, const unsigned char *blob, size_t size) {
+    // Grava num temporário e renomeia: uma escrita interrompida nunca deixa um .ghc pela metade
+    char tempPath[GH_CHART_PATH_MAX + 4];
+    int length = snprintf(tempPath, sizeof(tempPath), "%s.tmp", cachePath);
+    if (length < 0 || length >= (int)sizeof(tempPath)) {
+        printf("AVISO: Caminho longo demais para o cache do chart %s.\n", cachePath);
+        return;
+    }
+
+    FILE *f = fopen(tempPath, "wb");
+    if (!f) {
+        printf("AVISO: Nao foi possivel gravar o cache do chart %s.\n", cachePath);
+        return;
+    }
+    bool ok = fwrite(blob, 1, size, f) == size;
+    ok = (fclose(f) == 0) && ok;
+
+    remove(cachePath); // rename() no Windows falha se o destino existir
+    if (!ok || rename(tempPath, cachePath) != 0) {
+        remove(tempPath);
+        printf("AVISO: Nao foi possivel gravar o cache do chart %s.\n", cachePath);
+    }
+}
+
+// --- COMPILAÇÃO (MIDI -> NOTAS EM SEGUNDOS) ---
+// Converte os ticks em segundos pelo mapa de tempo e junta note-on/note-off em sustains
+static unsigned char *CompileChart(const MidiEventList *midi, const GhChartHeader *source, size_t *outSize) {
+    // Cada nota vem de um note-on: o total de eventos é um limite superior
+    GhChartNote *notes = (GhChartNote *)malloc((size_t)(midi->count > 0 ? midi->count : 1) * sizeof(GhChartNote));
+    if (!notes) return NULL;
+
+    uint32_t noteCount = 0;
+    float lastNoteTime = 0.0f;
+    int activeIndex[128];
+    for (int i = 0; i < 128; i++) activeIndex[i] = -1;
+    double currentTime = 0;
+    uint32_t lastTick = 0;
+    uint32_t tempo = 500000;
+
+    for (int i = 0; i < midi->count; i++) {
+        const MidiEvent *e = &midi->events[i];
+        uint32_t d = e->tick - lastTick;
+        currentTime += (double)d * (double)tempo / ((double)midi->ticksPerQN * 1000000.0);
+        lastTick = e->tick;
+
+        if (e->type == MIDI_EVENT_TEMPO) {
+            tempo = e->tempo;
+        } else if (e->type == MIDI_EVENT_NOTE_ON) {
+            notes[noteCount] = (GhChartNote){ (float)currentTime, 0.0f, e->note - GH_CHART_FIRST_NOTE };
+            activeIndex[e->note] = (int)noteCount;
+            if (notes[noteCount].time > lastNoteTime) lastNoteTime = notes[noteCount].time;
+            noteCount++;
+        } else if (e->type == MIDI_EVENT_NOTE_OFF) {
+            int idx = activeIndex[e->note];
+            if (idx != -1) {
+                float dur = (float)currentTime - notes[idx].time;
+                if (dur < 0) dur = 0;
+                notes[idx].sustain = dur;
+                if (notes[idx].time + dur > lastNoteTime) lastNoteTime = notes[idx].time + dur;
+                activeIndex[e->note] = -1;
+            }
+        }
+    }
+
+    size_t size = ChartBytes(noteCount);
+    unsigned char *blob = (unsigned char *)malloc(size);
+    if (!blob) {
+        free(notes);
+        return NULL;
+    }
+
+    GhChartHeader *header = (GhChartHeader *)blob;
+    *header = *source;
+    memcpy(header->magic, GH_CHART_MAGIC, 4);
+    header->version = GH_CHART_VERSION;
+    header->noteCount = noteCount;
+    header->lastNoteTime = lastNoteTime;
+
+    GhChartNote *outNotes = (GhChartNote *)(blob + sizeof(GhChartHeader));
+    uint32_t *laneIndex = (uint32_t *)(outNotes + noteCount);
+    memcpy(outNotes, notes, (size_t)noteCount * sizeof(GhChartNote));
+    free(notes);
+
+    // Índices por fret (contagem + prefixo): cada faixa mantém a ordem de tempo
+    uint32_t cursor[GH_CHART_FRETS] = { 0 };
+    memset(header->fretOffset, 0, sizeof(header->fretOffset));
+    for (uint32_t i = 0; i < noteCount; i++) header->fretOffset[outNotes[i].fret + 1]++;
+    for (int f = 0; f < GH_CHART_FRETS; f++) {
+        header->fretOffset[f + 1] += header->fretOffset[f];
+        cursor[f] = header->fretOffset[f];
+    }
+    for (uint32_t i = 0; i < noteCount; i++) laneIndex[cursor[outNotes[i].fret]++] = i;
+
+    *outSize = size;
+    return blob;
+}
+
+// --- API ---
+bool GhChart_Load(const char *midiPath, GhChart *chart) {
+    memset(chart, 0, sizeof(*chart));
+
+    MappedFile midiFile;
+    if (!MappedFile_Open(&midiFile, midiPath)) {
+        printf("ERRO: Arquivo MIDI %s nao encontrado.\n", midiPath);
+        return false;
+    }
+
+    GhChartHeader source = { 0 };
+    source.sourceSize = midiFile.size;
+    source.sourceMtime = FileMtime(midiPath);
+    source.sourceHash = HashBytes(midiFile.data, midiFile.size);
+
+    // Caminho que não cabe: compila sempre e não grava (um nome truncado apontaria para outro arquivo)
+    char cachePath[GH_CHART_PATH_MAX];
+    bool cacheable = GhChart_CachePath(midiPath, cachePath, sizeof(cachePath));
+    if (!cacheable) printf("AVISO: Caminho longo demais para o cache do chart de %s.\n", midiPath);
+
+    if (cacheable && OpenCache(chart, cachePath, &source)) {
+        MappedFile_Close(&midiFile);
+        chart->fromCache = true;
+        return true;
+    }
+
+    // Cache ausente ou desatualizado: compila o MIDI e grava o .ghc para a próxima vez
+    MidiEventList midi = { 0 };
+    bool parsed = GhMidi_Parse(midiFile.data, midiFile.size, &midi);
+    MappedFile_Close(&midiFile);
+
+    size_t size = 0;
+    unsigned char *blob = parsed ? CompileChart(&midi, &source, &size) : NULL;
+    GhMidi_Free(&midi);
+    if (!blob) return false;
+
+    if (cacheable) WriteCache(cachePath, blob, size);
+
+    chart->owned = blob;
+    BindChart(chart, blob);
+    return true;
+}
+
+void GhChart_Unload(GhChart *chart) {
+    MappedFile_Close(&chart->file);
+    free(chart->owned);
+    memset(chart, 0, sizeof(*chart));
+}
@@ -0,0 +1,59 @@
+#ifndef GH_CHART_H
+#define GH_CHART_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "mapped_file.h"
+
+// --- CHART COMPILADO (.ghc) ---
+// Cache binário gravado ao lado do MIDI (notes.mid -> notes.ghc) na primeira carga:
+//   [GhChartHeader][GhChartNote x noteCount][uint32 laneIndex x noteCount]
+// As notas ficam em ordem de tempo, já em segundos (mapa de tempo aplicado). laneIndex
+// lista, fret a fret, os índices das notas daquele fret (também em ordem de tempo):
+// as notas do fret f são laneIndex[fretOffset[f] .. fretOffset[f + 1] - 1].
+// O cache vale enquanto tamanho, data de modificação e hash do MIDI baterem com o header;
+// senão o MIDI é lido de novo e o .ghc reescrito. Campos little-endian (formato nativo).
+#define GH_CHART_MAGIC "GHCH"
+#define GH_CHART_VERSION 1
+#define GH_CHART_FRETS 5
+#define GH_CHART_FIRST_NOTE 84 // Nota MIDI do primeiro fret (Expert)
+#define GH_CHART_PATH_MAX 512  // Tamanho do buffer do caminho do .ghc
+
+typedef struct {
+    char magic[4];          // "GHCH"
+    uint32_t version;
+    uint64_t sourceSize;    // Tamanho do MIDI de origem
+    int64_t sourceMtime;    // Data de modificação do MIDI (segundos)
+    uint64_t sourceHash;    // FNV-1a 64 dos bytes do MIDI
+    uint32_t noteCount;
+    float lastNoteTime;     // Fim da última nota (incluindo sustain)
+    uint32_t fretOffset[GH_CHART_FRETS + 1];
+} GhChartHeader;
+
+typedef struct {
+    float time;             // Segundos desde o início da música
+    float sustain;          // Duração da nota longa (0 = nota simples)
+    int32_t fret;           // 0..GH_CHART_FRETS-1
+} GhChartNote;
+
+// Chart carregado: aponta direto para o mapeamento do .ghc (ou para memória própria,
+// quando o cache não pôde ser gravado)
+typedef struct {
+    const GhChartNote *notes;
+    const uint32_t *laneIndex;
+    uint32_t noteCount;
+    uint32_t fretOffset[GH_CHART_FRETS + 1];
+    float lastNoteTime;
+    bool fromCache;         // true se veio do .ghc sem ler o MIDI
+    MappedFile file;
+    void *owned;
+} GhChart;
+
+// Carrega o chart do MIDI: usa o .ghc válido ou compila o MIDI e grava o cache
+bool GhChart_Load(const char *midiPath, GhChart *chart);
+void GhChart_Unload(GhChart *chart);
+
+// Caminho do cache para um MIDI (troca a extensão por .ghc); false se não couber em out
+bool GhChart_CachePath(const char *midiPath, char *out, int outSize);
+
+#endif // GH_CHART_H
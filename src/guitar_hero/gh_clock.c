@@ -0,0 +1,44 @@
+#include "gh_clock.h"
+
+void GhClock_Reset(GhSongClock *clock) {
+    clock->offset = 0.0;
+    clock->lastWall = 0.0;
+    clock->lastOutput = 0.0;
+    clock->started = false;
+}
+
+double GhClock_Update(GhSongClock *clock, float rawSongTime, double wallTime) {
+    double bound = (double)rawSongTime - wallTime;
+
+    if (!clock->started) {
+        clock->offset = bound;
+        clock->lastOutput = rawSongTime;
+        clock->started = true;
+    } else {
+        double elapsed = wallTime - clock->lastWall;
+        if (elapsed > 0.0) clock->offset -= GH_CLOCK_DECAY * elapsed;
+
+        // O áudio nunca está adiantado: se a leitura passou do relógio, ele sobe até ela
+        if (bound > clock->offset) clock->offset = bound;
+        if (clock->offset - bound > GH_CLOCK_RESYNC) {
+            // O áudio voltou (loop ou troca de música): recomeça dele, mesmo andando para trás
+            clock->offset = bound;
+            clock->lastOutput = rawSongTime;
+        } else if (clock->offset - bound > GH_CLOCK_MAX_LEAD) {
+            // Áudio travado: não deixa o relógio fugir dele
+            clock->offset = bound + GH_CLOCK_MAX_LEAD;
+        }
+    }
+    clock->lastWall = wallTime;
+
+    double now = wallTime + clock->offset;
+    if (now < clock->lastOutput) now = clock->lastOutput; // Monotônico
+    clock->lastOutput = now;
+    return now;
+}
+
+double GhClock_Now(const GhSongClock *clock, double wallTime) {
+    if (!clock->started) return 0.0;
+    double now = wallTime + clock->offset;
+    return (now < clock->lastOutput) ? clock->lastOutput : now;
+}
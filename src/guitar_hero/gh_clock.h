@@ -0,0 +1,33 @@
+#ifndef GH_CLOCK_H
+#define GH_CLOCK_H
+
+#include <stdbool.h>
+
+// --- RELÓGIO SUAVIZADO DA MÚSICA ---
+// GetMusicTimePlayed anda aos degraus (um por bloco de áudio mandado ao mixer), então as
+// notas tremem e o tempo parado entre degraus vira erro de julgamento. Este relógio segue
+// o GetTime() (alta resolução) e usa o tempo do áudio só para se corrigir: cada leitura
+// diz que a música já está pelo menos naquele ponto (limite inferior), e o relógio sobe
+// até ele; entre leituras cede devagar, para acompanhar diferenças de ritmo entre o
+// dispositivo de áudio e o timer. O valor retornado nunca volta para trás.
+
+#define GH_CLOCK_DECAY 0.002        // Segundos cedidos por segundo (deriva máxima acompanhada)
+#define GH_CLOCK_MAX_LEAD 0.1       // Quanto o relógio pode ficar à frente do áudio (áudio travado)
+#define GH_CLOCK_RESYNC 0.25        // Diferença a partir da qual o relógio salta para o áudio
+
+typedef struct {
+    double offset;      // Tempo da música - GetTime()
+    double lastWall;
+    double lastOutput;
+    bool started;
+} GhSongClock;
+
+void GhClock_Reset(GhSongClock *clock);
+
+// Registra uma leitura do áudio (rawSongTime em wallTime) e devolve o tempo suavizado
+double GhClock_Update(GhSongClock *clock, float rawSongTime, double wallTime);
+
+// Tempo suavizado em wallTime sem nova leitura do áudio
+double GhClock_Now(const GhSongClock *clock, double wallTime);
+
+#endif // GH_CLOCK_H
@@ -0,0 +1,136 @@
+#include "gh_input.h"
+#include "raylib.h"
+#include <stdio.h>
+
+// --- ESTADO ---
+static int watchedKeys[GH_INPUT_MAX_KEYS];
+static int watchedCount = 0;
+static bool keyDown[GH_INPUT_MAX_KEYS];
+
+static GhInputEvent queue[GH_INPUT_QUEUE_SIZE];
+static int queueHead = 0;
+static int queueCount = 0;
+static int droppedEvents = 0;
+
+static double lastPollTime = 0.0;
+static double nextFrameTime = 0.0;
+static bool pacing = false;
+
+// Âncora do relógio da música: songTime = anchorSong + (wallTime - anchorWall)
+static double anchorWall = 0.0;
+static float anchorSong = 0.0f;
+
+// --- FILA ---
+static void PushEvent(int slot, bool down, double wallTime) {
+    if (queueCount == GH_INPUT_QUEUE_SIZE) {
+        droppedEvents++;
+        return;
+    }
+    GhInputEvent *e = &queue[(queueHead + queueCount) % GH_INPUT_QUEUE_SIZE];
+    e->slot = slot;
+    e->down = down;
+    e->wallTime = wallTime;
+    e->songTime = anchorSong + (float)(wallTime - anchorWall);
+    queueCount++;
+}
+
+static int SlotForKey(int key) {
+    for (int i = 0; i < watchedCount; i++) {
+        if (watchedKeys[i] == key) return i;
+    }
+    return -1;
+}
+
+// --- API ---
+void GhInput_Init(const int *keys, int keyCount) {
+    watchedCount = (keyCount < GH_INPUT_MAX_KEYS) ? keyCount : GH_INPUT_MAX_KEYS;
+    for (int i = 0; i < watchedCount; i++) {
+        watchedKeys[i] = keys[i];
+        keyDown[i] = false;
+    }
+    queueHead = 0; queueCount = 0; droppedEvents = 0;
+    lastPollTime = GetTime();
+    nextFrameTime = 0.0;
+    anchorWall = lastPollTime; anchorSong = 0.0f;
+}
+
+void GhInput_Begin(void) {
+    // O EndDrawing deixa de esperar: a espera passa a ser feita (e aproveitada) aqui
+    SetTargetFPS(0);
+    pacing = true;
+    nextFrameTime = 0.0;
+}
+
+void GhInput_End(void) {
+    if (!pacing) return;
+    SetTargetFPS(GH_INPUT_TARGET_FPS);
+    pacing = false;
+    if (droppedEvents > 0) printf("AVISO: GhInput descartou %d eventos (fila cheia).\n", droppedEvents);
+}
+
+void GhInput_SetSongClock(float songTime) {
+    anchorWall = GetTime();
+    anchorSong = songTime;
+}
+
+void GhInput_Poll(void) {
+    double now = GetTime();
+    // A transição aconteceu em algum ponto desde a última leitura: usa o meio do intervalo
+    double eventTime = (lastPollTime + now) * 0.5;
+    lastPollTime = now;
+
+    // Toques que começaram e terminaram entre duas leituras só aparecem na fila de teclas
+    bool tapped[GH_INPUT_MAX_KEYS] = { false };
+    for (int key = GetKeyPressed(); key != 0; key = GetKeyPressed()) {
+        int slot = SlotForKey(key);
+        if (slot >= 0) tapped[slot] = true;
+    }
+
+    for (int i = 0; i < watchedCount; i++) {
+        bool down = IsKeyDown(watchedKeys[i]);
+        if (down != keyDown[i]) {
+            PushEvent(i, down, eventTime);
+            keyDown[i] = down;
+        } else if (tapped[i] && !down) {
+            PushEvent(i, true, eventTime);
+            PushEvent(i, false, eventTime);
+        }
+    }
+}
+
+void GhInput_EndFrame(bool capture) {
+    GhInput_Poll(); // O EndDrawing acabou de ler o teclado: mantém o estado das teclas em dia
+    if (!pacing) return;
+
+    double now = GetTime();
+    const double frameSeconds = 1.0 / GH_INPUT_TARGET_FPS;
+    // Depois de um engasgo (ou no primeiro frame) o ritmo recomeça de agora
+    if (nextFrameTime <= 0.0 || now - nextFrameTime > frameSeconds) nextFrameTime = now;
+    nextFrameTime += frameSeconds;
+
+    while ((now = GetTime()) < nextFrameTime) {
+        double left = nextFrameTime - now;
+        WaitTime((left > GH_INPUT_POLL_SECONDS) ? GH_INPUT_POLL_SECONDS : left);
+        if (capture) {
+            PollInputEvents();
+            GhInput_Poll();
+        }
+    }
+}
+
+bool GhInput_NextEvent(GhInputEvent *event) {
+    if (queueCount == 0) return false;
+    *event = queue[queueHead];
+    queueHead = (queueHead + 1) % GH_INPUT_QUEUE_SIZE;
+    queueCount--;
+    return true;
+}
+
+void GhInput_ClearEvents(void) {
+    queueHead = 0;
+    queueCount = 0;
+}
+
+bool GhInput_IsDown(int slot) {
+    return (slot >= 0 && slot < watchedCount) ? keyDown[slot] : false;
+}
@@ -0,0 +1,55 @@
+#ifndef GH_INPUT_H
+#define GH_INPUT_H
+
+#include <stdbool.h>
+
+// --- ENTRADA COM CARIMBO DE TEMPO (SUB-FRAME) ---
+// A raylib só lê o teclado uma vez por frame (PollInputEvents dentro do EndDrawing), o
+// que arredonda o instante de cada toque para a grade de 16,7 ms dos 60 FPS. Durante a
+// partida o Guitar Hero assume o controle do ritmo de frames (GhInput_EndFrame): em vez
+// de dormir o resto do frame de uma vez, lê o teclado a cada ~1 ms e grava cada
+// transição (apertou/soltou) com o horário em que foi vista, já convertido para o tempo
+// da música pela última âncora do relógio de áudio (GhInput_SetSongClock).
+
+#define GH_INPUT_MAX_KEYS 8
+#define GH_INPUT_QUEUE_SIZE 64
+#define GH_INPUT_TARGET_FPS 60          // Mesmo alvo do SetTargetFPS do system.c
+#define GH_INPUT_POLL_SECONDS 0.001     // Intervalo entre leituras enquanto espera o frame
+
+typedef struct {
+    int slot;           // Índice da tecla na lista passada ao GhInput_Init
+    bool down;          // true = apertou, false = soltou
+    double wallTime;    // GetTime() estimado do evento (meio do intervalo entre leituras)
+    float songTime;     // Mesmo instante no tempo da música
+} GhInputEvent;
+
+// Define as teclas observadas (slot = posição no array) e zera a fila
+void GhInput_Init(const int *keys, int keyCount);
+
+// Liga/desliga o ritmo de frames próprio (SetTargetFPS(0) enquanto ativo)
+void GhInput_Begin(void);
+void GhInput_End(void);
+
+// Âncora do relógio: o tempo da música vale songTime agora (chamar uma vez por frame)
+void GhInput_SetSongClock(float songTime);
+
+// Lê o teclado agora e enfileira as transições das teclas observadas
+void GhInput_Poll(void);
+
+// Chamar logo após o EndDrawing: registra o que o EndDrawing leu e espera até o próximo
+// frame, lendo o teclado a cada GH_INPUT_POLL_SECONDS quando capture = true.
+// Atenção: cada PollInputEvents copia o estado atual das teclas para o anterior, então com
+// capture = true o IsKeyPressed/IsKeyReleased do frame seguinte só enxerga o que mudou na
+// última leitura (~1 ms) e perde quase todos os toques; o GetKeyPressed também não serve,
+// porque o GhInput_Poll esvazia a fila. Nos estados que capturam, leia as teclas só pelos
+// eventos deste módulo (tecla observada no GhInput_Init) ou desligue o capture antes.
+void GhInput_EndFrame(bool capture);
+
+// Retira o evento mais antigo da fila; false quando vazia
+bool GhInput_NextEvent(GhInputEvent *event);
+void GhInput_ClearEvents(void);
+
+// Estado mais recente da tecla (inclui transições ainda na fila)
+bool GhInput_IsDown(int slot);
+
+#endif // GH_INPUT_H
@@ -0,0 +1,250 @@
+#include "gh_midi.h"
+#include "mapped_file.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GUITAR_NOTE_MIN 84
+#define GUITAR_NOTE_MAX 88
+#define INITIAL_EVENT_CAPACITY 4096
+
+// --- CURSOR ---
+// Todas as leituras passam por aqui: ler além do fim marca erro e devolve zero
+typedef struct {
+    const unsigned char *pos;
+    const unsigned char *end;
+    bool error;
+} ByteCursor;
+
+static int ReadByte(ByteCursor *c) {
+    if (c->pos >= c->end) {
+        c->error = true;
+        return 0;
+    }
+    return *c->pos++;
+}
+
+static int PeekByte(ByteCursor *c) {
+    if (c->pos >= c->end) {
+        c->error = true;
+        return 0;
+    }
+    return *c->pos;
+}
+
+static uint32_t ReadBE32(ByteCursor *c) {
+    uint32_t v = (uint32_t)ReadByte(c) << 24;
+    v |= (uint32_t)ReadByte(c) << 16;
+    v |= (uint32_t)ReadByte(c) << 8;
+    return v | (uint32_t)ReadByte(c);
+}
+
+static uint16_t ReadBE16(ByteCursor *c) {
+    uint16_t v = (uint16_t)(ReadByte(c) << 8);
+    return (uint16_t)(v | ReadByte(c));
+}
+
+// Quantidade de tamanho variável: no máximo 4 bytes (28 bits) pelo padrão
+static uint32_t ReadVarLen(ByteCursor *c) {
+    uint32_t v = 0;
+    for (int i = 0; i < 4; i++) {
+        int b = ReadByte(c);
+        v = (v << 7) | (uint32_t)(b & 0x7F);
+        if (!(b & 0x80)) return v;
+    }
+    c->error = true;
+    return v;
+}
+
+static void Skip(ByteCursor *c, uint32_t length) {
+    if ((size_t)(c->end - c->pos) < length) {
+        c->pos = c->end;
+        c->error = true;
+        return;
+    }
+    c->pos += length;
+}
+
+// --- LISTA DE EVENTOS ---
+static bool PushEvent(MidiEventList *list, MidiEvent event) {
+    if (list->count == list->capacity) {
+        int capacity = list->capacity ? list->capacity * 2 : INITIAL_EVENT_CAPACITY;
+        MidiEvent *grown = (MidiEvent *)realloc(list->events, (size_t)capacity * sizeof(MidiEvent));
+        if (!grown) return false;
+        list->events = grown;
+        list->capacity = capacity;
+    }
+    list->events[list->count++] = event;
+    return true;
+}
+
+// Ordenação estável por tick (merge sort): cada trilha já vem em ordem, e eventos no
+// mesmo tick mantêm a ordem do arquivo (note-off antes do note-on seguinte, por exemplo)
+static bool SortByTick(MidiEvent *events, int count) {
+    if (count < 2) return true;
+
+    MidiEvent *temp = (MidiEvent *)malloc((size_t)count * sizeof(MidiEvent));
+    if (!temp) return false;
+
+    MidiEvent *src = events, *dst = temp;
+    for (int width = 1; width < count; width *= 2) {
+        for (int lo = 0; lo < count; lo += 2 * width) {
+            int mid = (lo + width < count) ? lo + width : count;
+            int hi = (lo + 2 * width < count) ? lo + 2 * width : count;
+            int a = lo, b = mid, k = lo;
+            while (a < mid && b < hi) dst[k++] = (src[b].tick < src[a].tick) ? src[b++] : src[a++];
+            while (a < mid) dst[k++] = src[a++];
+            while (b < hi) dst[k++] = src[b++];
+        }
+        MidiEvent *swap = src; src = dst; dst = swap;
+    }
+
+    if (src != events) memcpy(events, src, (size_t)count * sizeof(MidiEvent));
+    free(temp);
+    return true;
+}
+
+static bool ContainsText(const unsigned char *text, uint32_t length, const char *needle) {
+    size_t n = strlen(needle);
+    for (uint32_t i = 0; i + n <= length; i++) {
+        if (memcmp(text + i, needle, n) == 0) return true;
+    }
+    return false;
+}
+
+// --- TRILHAS ---
+// Dados inválidos marcam c->error (o resto da trilha é ignorado); false só se faltar memória
+static bool ParseTrack(ByteCursor *c, MidiEventList *list) {
+    int trackStart = list->count;
+    bool isGuitar = false;
+    uint32_t absTick = 0;
+    int runningStatus = 0;
+
+    while (c->pos < c->end && !c->error) {
+        absTick += ReadVarLen(c);
+
+        int status = PeekByte(c);
+        if (status & 0x80) {
+            c->pos++;
+            runningStatus = (status < 0xF0) ? status : 0; // Meta/SysEx cancelam o running status
+        } else {
+            status = runningStatus;
+        }
+        if (c->error) break;
+
+        if (status == 0xFF) {
+            int type = ReadByte(c);
+            uint32_t length = ReadVarLen(c);
+            if ((size_t)(c->end - c->pos) < length) {
+                c->error = true;
+                break;
+            }
+
+            if (type == 0x03 && ContainsText(c->pos, length, "PART GUITAR")) {
+                isGuitar = true;
+            } else if (type == 0x51 && length == 3) {
+                uint32_t tempo = ((uint32_t)c->pos[0] << 16) | ((uint32_t)c->pos[1] << 8) | c->pos[2];
+                if (!PushEvent(list, (MidiEvent){ absTick, MIDI_EVENT_TEMPO, 0, tempo })) return false;
+            }
+            c->pos += length;
+        } else if (status == 0xF0 || status == 0xF7) {
+            Skip(c, ReadVarLen(c));
+        } else if (status == 0) {
+            c->error = true; // Byte de dados sem status anterior
+        } else {
+            int type = status & 0xF0;
+            if (type == 0x90 || type == 0x80) {
+                int note = ReadByte(c);
+                int velocity = ReadByte(c);
+                if (!c->error && note >= GUITAR_NOTE_MIN && note <= GUITAR_NOTE_MAX) {
+                    int eventType = (type == 0x90 && velocity > 0) ? MIDI_EVENT_NOTE_ON : MIDI_EVENT_NOTE_OFF;
+                    if (!PushEvent(list, (MidiEvent){ absTick, eventType, note, 0 })) return false;
+                }
+            } else {
+                ReadByte(c);
+                if (type != 0xC0 && type != 0xD0) ReadByte(c);
+            }
+        }
+    }
+
+    // O nome da trilha pode vir depois das notas: fora da guitarra só ficam os tempos
+    if (!isGuitar) {
+        int write = trackStart;
+        for (int i = trackStart; i < list->count; i++) {
+            if (list->events[i].type == MIDI_EVENT_TEMPO) list->events[write++] = list->events[i];
+        }
+        list->count = write;
+    }
+    return true;
+}
+
+// --- API ---
+bool GhMidi_Parse(const unsigned char *data, size_t size, MidiEventList *list) {
+    list->count = 0;
+    list->ticksPerQN = 480;
+
+    ByteCursor c = { data, data + size, false };
+    if (size < 14 || memcmp(data, "MThd", 4) != 0) {
+        printf("ERRO: Cabecalho MIDI invalido.\n");
+        return false;
+    }
+    c.pos += 4;
+    uint32_t headerLength = ReadBE32(&c);
+    ByteCursor header = { c.pos, c.pos + (headerLength < 6 ? headerLength : 6), false };
+    Skip(&c, headerLength);
+
+    ReadBE16(&header); // Formato (0/1): as trilhas são lidas em sequência de qualquer jeito
+    uint16_t trackCount = ReadBE16(&header);
+    uint16_t division = ReadBE16(&header);
+    if (header.error || c.error || (division & 0x8000) || division == 0) {
+        printf("ERRO: Cabecalho MIDI invalido (divisao SMPTE nao suportada).\n");
+        return false;
+    }
+    list->ticksPerQN = division;
+
+    for (int t = 0; t < trackCount; t++) {
+        if ((size_t)(c.end - c.pos) < 8 || memcmp(c.pos, "MTrk", 4) != 0) break;
+        c.pos += 4;
+        uint32_t length = ReadBE32(&c);
+
+        size_t available = (size_t)(c.end - c.pos);
+        if (length > available) {
+            printf("AVISO: Trilha MIDI %d truncada.\n", t);
+            length = (uint32_t)available;
+        }
+
+        ByteCursor track = { c.pos, c.pos + length, false };
+        if (!ParseTrack(&track, list)) {
+            printf("ERRO: Sem memoria para os eventos MIDI (trilha %d).\n", t);
+            return false;
+        }
+        if (track.error) printf("AVISO: Trilha MIDI %d com dados invalidos, resto ignorado.\n", t);
+
+        c.pos += length;
+    }
+
+    if (!SortByTick(list->events, list->count)) {
+        printf("ERRO: Sem memoria para ordenar os eventos MIDI.\n");
+        return false;
+    }
+    return true;
+}
+
+bool GhMidi_Load(const char *path, MidiEventList *list) {
+    MappedFile file;
+    if (!MappedFile_Open(&file, path)) {
+        printf("ERRO: Arquivo MIDI %s nao encontrado.\n", path);
+        return false;
+    }
+
+    bool ok = GhMidi_Parse(file.data, file.size, list);
+    MappedFile_Close(&file);
+    return ok;
+}
+
+void GhMidi_Free(MidiEventList *list) {
+    free(list->events);
+    list->events = NULL;
+    list->count = 0;
+    list->capacity = 0;
+}
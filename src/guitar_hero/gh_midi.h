@@ -0,0 +1,45 @@
+#ifndef GH_MIDI_H
+#define GH_MIDI_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// --- PARSER MIDI DO GUITAR HERO ---
+// O arquivo é mapeado (MappedFile) e decodificado com um cursor sobre os bytes, sem
+// fgetc/fseek por evento. Não depende da raylib (também é usado pelo tools/midi_bench).
+// Só guarda o que o jogo usa: mudanças de tempo de todas as trilhas e as notas 84..88
+// (Expert, 5 frets) da trilha "PART GUITAR".
+
+typedef enum {
+    MIDI_EVENT_TEMPO = 0,
+    MIDI_EVENT_NOTE_ON,
+    MIDI_EVENT_NOTE_OFF
+} MidiEventType;
+
+typedef struct {
+    uint32_t tick;      // Tick absoluto
+    int type;           // MidiEventType
+    int note;           // Nota MIDI (eventos de nota)
+    uint32_t tempo;     // Microssegundos por semínima (eventos de tempo)
+} MidiEvent;
+
+// Lista crescente de eventos (dobra a capacidade quando enche), ordenada por tick
+typedef struct {
+    MidiEvent *events;
+    int count;
+    int capacity;
+    uint16_t ticksPerQN;
+} MidiEventList;
+
+// Decodifica um MIDI já em memória. Leituras são checadas contra o fim do buffer:
+// uma trilha truncada só perde o resto dela. Retorna false se o cabeçalho for inválido
+// ou se faltar memória para os eventos (a lista pode ficar parcial: chamar GhMidi_Free).
+bool GhMidi_Parse(const unsigned char *data, size_t size, MidiEventList *list);
+
+// Mapeia o arquivo e chama GhMidi_Parse
+bool GhMidi_Load(const char *path, MidiEventList *list);
+
+void GhMidi_Free(MidiEventList *list);
+
+#endif // GH_MIDI_H
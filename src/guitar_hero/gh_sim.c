@@ -0,0 +1,194 @@
+#include "gh_sim.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+// --- AUXILIARES ---
+static void AddJudgement(GhSim *sim, GhJudgeType type, int fret, float offsetMs) {
+    sim->judgeTotals[type]++;
+    if (sim->judgementCount < GH_SIM_MAX_JUDGEMENTS) {
+        sim->judgements[sim->judgementCount++] = (GhJudgement){ type, fret, offsetMs };
+    }
+}
+
+static void RecordHit(GhHitHistogram *h, float offsetMs) {
+    int bin = (int)floorf((offsetMs + GH_HIST_RANGE_MS) / GH_HIST_BIN_MS);
+    if (bin < 0) bin = 0;
+    if (bin >= GH_HIST_BINS) bin = GH_HIST_BINS - 1;
+    h->bins[bin]++;
+
+    if (h->count == 0 || offsetMs < h->minMs) h->minMs = offsetMs;
+    if (h->count == 0 || offsetMs > h->maxMs) h->maxMs = offsetMs;
+    h->count++;
+    h->sumMs += offsetMs;
+    h->sumSqMs += (double)offsetMs * offsetMs;
+}
+
+static void LoseHealth(GhSim *sim) {
+    sim->health -= 5.0f;
+    if (sim->health <= 0) { sim->health = 0; sim->state = GH_SIM_LOSE; }
+}
+
+GhNote *GhSim_LaneNote(GhSim *sim, int fret, int k) {
+    return &sim->notes[sim->laneNotes[sim->lanes[fret].start + k]];
+}
+
+// Avança os cursores sobre as notas já resolvidas
+static void AdvanceLanes(GhSim *sim) {
+    for (int f = 0; f < GH_SIM_FRETS; f++) {
+        GhFretLane *lane = &sim->lanes[f];
+        while (lane->firstLive < lane->count && !GhSim_LaneNote(sim, f, lane->firstLive)->active) lane->firstLive++;
+        if (lane->next < lane->firstLive) lane->next = lane->firstLive;
+        while (lane->next < lane->count) {
+            GhNote *n = GhSim_LaneNote(sim, f, lane->next);
+            if (n->active && !n->hit) break;
+            lane->next++;
+        }
+    }
+}
+
+// --- CHART -> NOTAS ---
+void GhSim_Load(GhSim *sim, const GhChart *chart) {
+    memset(sim, 0, sizeof(*sim));
+    sim->state = GH_SIM_PLAYING;
+    sim->health = 50.0f;
+
+    for (uint32_t i = 0; i < chart->noteCount && sim->noteCount < GH_SIM_MAX_NOTES; i++) {
+        const GhChartNote *n = &chart->notes[i];
+        sim->notes[sim->noteCount++] = (GhNote){ n->time, n->fret, n->sustain, true, false };
+        if (n->time + n->sustain > sim->lastNoteTime) sim->lastNoteTime = n->time + n->sustain;
+    }
+
+    // As faixas vêm prontas do chart (laneIndex); só ficam de fora notas além do limite
+    int laneCount = 0;
+    for (int f = 0; f < GH_SIM_FRETS; f++) {
+        sim->lanes[f] = (GhFretLane){ laneCount, 0, 0, 0 };
+        for (uint32_t k = chart->fretOffset[f]; k < chart->fretOffset[f + 1]; k++) {
+            if (chart->laneIndex[k] < (uint32_t)sim->noteCount) sim->laneNotes[laneCount++] = (int)chart->laneIndex[k];
+        }
+        sim->lanes[f].count = laneCount - sim->lanes[f].start;
+    }
+}
+
+// --- PASSO ---
+void GhSim_BeginStep(GhSim *sim, float songTime) {
+    sim->judgementCount = 0;
+    if (sim->state == GH_SIM_PLAYING && songTime > sim->lastNoteTime + 3.0f && sim->noteCount > 0) sim->state = GH_SIM_WIN;
+    AdvanceLanes(sim);
+}
+
+// Julga um toque no instante em que ele aconteceu, não no instante do passo que o processa
+void GhSim_Press(GhSim *sim, int fret, float time) {
+    if (sim->state != GH_SIM_PLAYING) return;
+
+    // Candidatas: notas não julgadas do fret dentro da janela, a partir do cursor
+    GhFretLane *lane = &sim->lanes[fret];
+    GhNote *best = NULL;
+    float bestDiff = GH_SIM_HIT_WINDOW + 0.001f;
+    for (int k = lane->next; k < lane->count; k++) {
+        GhNote *n = GhSim_LaneNote(sim, fret, k);
+        float diff = fabsf(n->time - time);
+        if (n->time > time && diff >= bestDiff) break;
+        if (!n->active || n->hit) continue;
+        if (diff < bestDiff) {
+            bestDiff = diff;
+            best = n;
+        }
+    }
+
+    if (best) {
+        best->hit = true;
+        sim->score += 100 + (sim->combo * 10);
+        sim->combo++;
+        float offsetMs = (time - best->time) * 1000.0f;
+        RecordHit(&sim->histogram, offsetMs);
+        AddJudgement(sim, GH_JUDGE_HIT, fret, offsetMs);
+        if (best->sustain < 0.1f) best->active = false;
+        sim->health += 5.0f;
+        if (sim->health > 100) sim->health = 100;
+    } else {
+        sim->combo = 0;
+        sim->score -= 50;
+        if (sim->score < 0) sim->score = 0;
+        AddJudgement(sim, GH_JUDGE_OVERSTRUM, fret, 0.0f);
+        LoseHealth(sim);
+    }
+    AdvanceLanes(sim);
+}
+
+// Soltar o fret antes do fim de uma nota longa já acertada encerra a nota e zera o combo
+void GhSim_Release(GhSim *sim, int fret, float time) {
+    if (sim->state != GH_SIM_PLAYING) return;
+
+    GhFretLane *lane = &sim->lanes[fret];
+    for (int k = lane->firstLive; k < lane->count; k++) {
+        GhNote *n = GhSim_LaneNote(sim, fret, k);
+        if (n->time > time) break;
+        if (!n->active || !n->hit || n->sustain <= 0) continue;
+        if (time < n->time + n->sustain) {
+            n->active = false;
+            sim->combo = 0;
+            AddJudgement(sim, GH_JUDGE_DROP, fret, 0.0f);
+        }
+    }
+    AdvanceLanes(sim);
+}
+
+void GhSim_EndStep(GhSim *sim, float songTime, float dt, const bool *held) {
+    for (int f = 0; f < GH_SIM_FRETS; f++) sim->sustaining[f] = false;
+    if (sim->state != GH_SIM_PLAYING) return;
+
+    // Só notas até o fim da janela de acerto podem ter sido perdidas ou estar em sustain
+    const float judgeHorizon = songTime + GH_SIM_HIT_WINDOW;
+
+    for (int fret = 0; fret < GH_SIM_FRETS; fret++) {
+        GhFretLane *lane = &sim->lanes[fret];
+        for (int k = lane->firstLive; k < lane->count; k++) {
+            GhNote *n = GhSim_LaneNote(sim, fret, k);
+            if (n->time > judgeHorizon) break;
+            if (!n->active) continue;
+            if (n->hit) {
+                if (songTime > n->time + n->sustain) {
+                    n->active = false;
+                } else if (n->sustain > 0 && held[fret]) {
+                    // Soltar antes do fim já encerrou a nota no GhSim_Release
+                    sim->score += 100 * dt;
+                    sim->sustaining[fret] = true;
+                }
+            } else if ((n->time - songTime) < -GH_SIM_HIT_WINDOW) {
+                n->active = false;
+                sim->combo = 0;
+                sim->score -= 50;
+                if (sim->score < 0) sim->score = 0;
+                AddJudgement(sim, GH_JUDGE_MISS, fret, 0.0f);
+                LoseHealth(sim);
+            }
+        }
+    }
+
+    AdvanceLanes(sim);
+}
+
+// --- HISTOGRAMA ---
+void GhSim_PrintHistogram(const GhSim *sim) {
+    const GhHitHistogram *h = &sim->histogram;
+    if (h->count == 0) {
+        printf("GuitarHero: nenhum acerto registrado.\n");
+        return;
+    }
+
+    double mean = h->sumMs / h->count;
+    double variance = h->sumSqMs / h->count - mean * mean;
+    printf("GuitarHero: %d acertos, desvio medio %+.1f ms, desvio padrao %.1f ms (min %+.1f, max %+.1f)\n",
+           h->count, mean, sqrt(variance > 0.0 ? variance : 0.0), h->minMs, h->maxMs);
+
+    int peak = 1;
+    for (int i = 0; i < GH_HIST_BINS; i++) if (h->bins[i] > peak) peak = h->bins[i];
+    for (int i = 0; i < GH_HIST_BINS; i++) {
+        if (h->bins[i] == 0) continue;
+        int from = i * GH_HIST_BIN_MS - GH_HIST_RANGE_MS;
+        int bar = (h->bins[i] * 40 + peak - 1) / peak;
+        printf("  %+4d..%+4d ms %5d %.*s\n", from, from + GH_HIST_BIN_MS, h->bins[i], bar,
+               "########################################");
+    }
+}
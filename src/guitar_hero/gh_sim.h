@@ -0,0 +1,97 @@
+#ifndef GH_SIM_H
+#define GH_SIM_H
+
+#include <stdbool.h>
+#include "gh_chart.h"
+
+// --- SIMULAÇÃO DO GUITAR HERO (JULGAMENTO E PONTUAÇÃO) ---
+// Tudo o que decide acerto, erro, combo, vida e vitória, sem raylib: o guitar_hero.c
+// alimenta com o tempo da música e os toques do gh_input, e o tools/gh_autoplay roda o
+// mesmo código sem janela nem áudio. Cada passo (frame) é:
+//   GhSim_BeginStep -> GhSim_Press/GhSim_Release (em ordem) -> GhSim_EndStep
+// e deixa em judgements[] o que aconteceu no passo, para os efeitos visuais.
+
+#define GH_SIM_FRETS GH_CHART_FRETS
+#define GH_SIM_MAX_NOTES 10000
+#define GH_SIM_HIT_WINDOW 0.110f        // Segundos para cada lado da nota
+#define GH_SIM_MAX_JUDGEMENTS 64
+
+// Histograma dos desvios de acerto (toque - nota, em ms; positivo = atrasado)
+#define GH_HIST_BIN_MS 5
+#define GH_HIST_RANGE_MS 120            // Cobre -120..+120 ms (além da janela de acerto)
+#define GH_HIST_BINS (2 * GH_HIST_RANGE_MS / GH_HIST_BIN_MS)
+
+typedef struct { float time; int fret; float sustain; bool active; bool hit; } GhNote;
+
+// Faixas por fret: índices das notas de cada fret em ordem de tempo. Os cursores só andam
+// para frente, então julgar e desenhar custa O(notas visíveis), não O(tamanho da música)
+typedef struct {
+    int start;      // Início da faixa em laneNotes[]
+    int count;
+    int next;       // Primeira nota ainda não julgada (nem acertada nem perdida)
+    int firstLive;  // Primeira nota ainda ativa (por vir ou com sustain em andamento)
+} GhFretLane;
+
+typedef enum { GH_SIM_PLAYING, GH_SIM_WIN, GH_SIM_LOSE } GhSimState;
+
+typedef enum {
+    GH_JUDGE_HIT,           // Toque dentro da janela de uma nota
+    GH_JUDGE_MISS,          // Nota passou sem toque
+    GH_JUDGE_OVERSTRUM,     // Toque sem nota na janela
+    GH_JUDGE_DROP,          // Nota longa solta antes do fim
+    GH_JUDGE_TYPE_COUNT
+} GhJudgeType;
+
+typedef struct {
+    GhJudgeType type;
+    int fret;
+    float offsetMs;         // Só para GH_JUDGE_HIT
+} GhJudgement;
+
+typedef struct {
+    int bins[GH_HIST_BINS];
+    int count;
+    double sumMs;
+    double sumSqMs;
+    float minMs;
+    float maxMs;
+} GhHitHistogram;
+
+typedef struct {
+    GhNote notes[GH_SIM_MAX_NOTES];
+    int noteCount;
+    int laneNotes[GH_SIM_MAX_NOTES];
+    GhFretLane lanes[GH_SIM_FRETS];
+    float lastNoteTime;
+
+    GhSimState state;
+    float score;
+    int combo;
+    float health;
+
+    bool sustaining[GH_SIM_FRETS];                      // Nota longa segurada neste passo
+    GhJudgement judgements[GH_SIM_MAX_JUDGEMENTS];      // O que aconteceu neste passo
+    int judgementCount;
+    int judgeTotals[GH_JUDGE_TYPE_COUNT];               // Totais da partida
+    GhHitHistogram histogram;
+} GhSim;
+
+// Copia as notas do chart (até GH_SIM_MAX_NOTES) e zera a partida
+void GhSim_Load(GhSim *sim, const GhChart *chart);
+
+// Início do passo: limpa judgements[] e declara vitória depois da última nota
+void GhSim_BeginStep(GhSim *sim, float songTime);
+
+// Toques, no instante em que aconteceram (tempo da música), em ordem
+void GhSim_Press(GhSim *sim, int fret, float time);
+void GhSim_Release(GhSim *sim, int fret, float time);
+
+// Fim do passo: notas perdidas e pontos das notas longas seguradas (held[fret])
+void GhSim_EndStep(GhSim *sim, float songTime, float dt, const bool *held);
+
+// k-ésima nota (em ordem de tempo) da faixa do fret
+GhNote *GhSim_LaneNote(GhSim *sim, int fret, int k);
+
+void GhSim_PrintHistogram(const GhSim *sim);
+
+#endif // GH_SIM_H
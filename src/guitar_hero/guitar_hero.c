@@ -1,8 +1,14 @@
 #include "guitar_hero.h"
 #include "raylib.h"
+#include "asset_cache.h"
+#include "gh_chart.h"
+#include "gh_input.h"
+#include "gh_clock.h"
+#include "gh_calibration.h"
+#include "gh_sim.h"
+#include "particles.h"
 #include <stdio.h>
 #include <stdlib.h>
-#include <stdint.h>
 #include <string.h>
 #include <math.h>
 
@@ -13,11 +19,7 @@
 #define GUTTER_WIDTH 300
 #define NUM_FRETS 5
 #define SPEED 450.0f
-#define HIT_WINDOW_MS 110.0f
-#define MAX_EVENTS 60000
-#define MAX_NOTES 10000
 #define MAX_PARTICLES 800
-#define PARTICLE_LIFE 0.8f
 #define BASE_HIT_ZONE_OFFSET 75.0f
 
 // --- CORES ---
@@ -26,31 +28,30 @@
 #define CYBER_BLUE (Color){ 0, 243, 255, 255 }
 
 // --- ESTRUTURAS ---
-typedef struct { uint32_t tick; int type; int note; uint32_t tempo; } RawEvent;
-typedef struct { float time; int fret; float sustain; bool active; bool hit; } Note;
-typedef struct { Vector2 position; Vector2 velocity; Color color; float life; bool active; } Particle;
-typedef enum { STATE_START, STATE_PLAYING, STATE_WIN, STATE_LOSE } GHState;
+typedef enum { STATE_START, STATE_PLAYING, STATE_WIN, STATE_LOSE, STATE_CALIBRATE } GHState;
 
 // --- GLOBAIS ---
-static RawEvent events[MAX_EVENTS];
-static int eventCount = 0;
-static Note notes[MAX_NOTES];
-static int noteCount = 0;
-static float lastNoteTime = 0.0f;
-static Particle particles[MAX_PARTICLES];
-static int particlePoolIndex = 0;
+// Notas, julgamento e pontuação da partida (gh_sim.c, sem raylib)
+static GhSim sim;
+static ParticleSystem particles;
 static float fret_positions[NUM_FRETS];
 static Color fret_colors[NUM_FRETS] = { GREEN, RED, YELLOW, BLUE, ORANGE };
 static int key_bindings[NUM_FRETS] = { KEY_A, KEY_S, KEY_D, KEY_F, KEY_G };
 static char* key_names[NUM_FRETS] = { "A", "S", "D", "F", "G" };
 static float fret_miss_timer[NUM_FRETS] = {0.0f};
 
+// Teclas observadas pelo gh_input: os frets (slot = fret) e o cheat de vitória
+#define CHEAT_SLOT NUM_FRETS
+static int input_keys[NUM_FRETS + 1];
+
 // Variáveis de estado
 static GHState ghState = STATE_START;
-static float score = 0;
-static int combo = 0;
-static float health = 50.0f;
-static float audioOffset = 0.0f;
+
+// Tempo da música: relógio suavizado (gh_clock) menos a latência de saída calibrada.
+// songPosition é o tempo "ouvido" no frame atual, usado no julgamento e no desenho
+static GhSongClock songClock;
+static GhLatency latency = {0};
+static float songPosition = 0.0f;
 
 // Assets
 static Texture2D background = {0};
@@ -72,150 +73,6 @@ static float current_hit_zone_y = 0.0f;
 static float current_game_area_start_x = 0.0f;
 static float current_game_area_width = 0.0f;
 
-// --- AUXILIARES MIDI/PARSER ---
-static uint32_t read_be32(FILE *f) {
-    int a = fgetc(f); int b = fgetc(f); int c = fgetc(f); int d = fgetc(f);
-    return ((uint32_t)a << 24) | ((uint32_t)b << 16) | ((uint32_t)c << 8) | (uint32_t)d;
-}
-static uint16_t read_be16(FILE *f) {
-    int a = fgetc(f); int b = fgetc(f);
-    return (uint16_t)(((uint16_t)a << 8) | (uint16_t)b);
-}
-static uint32_t read_varlen(FILE *f) {
-    uint32_t v = 0; int c;
-    while ((c = fgetc(f)) != EOF) {
-        v = (v << 7) | (c & 0x7F);
-        if (!(c & 0x80)) break;
-    }
-    return v;
-}
-static int cmp_raw_event(const void *pa, const void *pb) {
-    const RawEvent *a = (const RawEvent*)pa;
-    const RawEvent *b = (const RawEvent*)pb;
-    if (a->tick < b->tick) return -1;
-    if (a->tick > b->tick) return 1;
-    return 1;
-}
-int parseMidiFile(const char *path, uint16_t *out_ticksPerQN) {
-    FILE *f = fopen(path, "rb");
-    if (!f) { printf("ERRO: Arquivo MIDI %s nao encontrado.\n", path); return 0; }
-    fseek(f, 4 + 4, SEEK_SET);
-    read_be16(f);
-    uint16_t ntrks = read_be16(f);
-    *out_ticksPerQN = read_be16(f);
-    eventCount = 0;
-
-    for (int t = 0; t < ntrks; t++) {
-        char tag[4];
-        if (fread(tag, 1, 4, f) != 4) break;
-        if (strncmp(tag, "MTrk", 4) != 0) break;
-        uint32_t len = read_be32(f);
-        long end = ftell(f) + len;
-        int tempStart = eventCount;
-        bool isGuitar = false;
-        uint32_t absTick = 0;
-        unsigned char rs = 0;
-
-        while (ftell(f) < end) {
-            uint32_t delta = read_varlen(f);
-            absTick += delta;
-            unsigned char st = 0;
-            int c = fgetc(f);
-            if (c & 0x80) {
-                st = c; rs = st;
-            } else {
-                st = rs; ungetc(c, f);
-            }
-            if (st == 0xFF) {
-                int type = fgetc(f);
-                uint32_t l = read_varlen(f);
-                long dp = ftell(f);
-                if (type == 0x03) {
-                    char n[256] = {0};
-                    if (l < 255) fread(n, 1, l, f);
-                    if (strstr(n, "PART GUITAR")) isGuitar = true;
-                } else if (type == 0x51 && l == 3) {
-                    int b1 = fgetc(f); int b2 = fgetc(f); int b3 = fgetc(f);
-                    if (eventCount < MAX_EVENTS) {
-                        events[eventCount] = (RawEvent){absTick, 0, 0, (b1 << 16) | (b2 << 8) | b3};
-                        eventCount++;
-                    }
-                }
-                fseek(f, dp + l, SEEK_SET);
-            } else if (st == 0xF0 || st == 0xF7) {
-                uint32_t l = read_varlen(f);
-                fseek(f, l, SEEK_CUR);
-            } else {
-                int type = st & 0xF0;
-                if (type == 0x90 || type == 0x80) {
-                    int n = fgetc(f);
-                    int v = fgetc(f);
-                    if (n >= 84 && n <= 88 && eventCount < MAX_EVENTS) {
-                        events[eventCount] = (RawEvent){absTick, (type == 0x90 && v > 0) ? 1 : 2, n, 0};
-                        eventCount++;
-                    }
-                } else {
-                    fgetc(f);
-                    if ((type & 0xF0) != 0xC0 && (type & 0xF0) != 0xD0) fgetc(f);
-                }
-            }
-        }
-
-        if (!isGuitar) {
-            int wIdx = tempStart;
-            for (int i = tempStart; i < eventCount; i++) {
-                if (events[i].type == 0) {
-                    events[wIdx++] = events[i];
-                }
-            }
-            eventCount = wIdx;
-        }
-        fseek(f, end, SEEK_SET);
-    }
-
-    fclose(f);
-    qsort(events, eventCount, sizeof(RawEvent), cmp_raw_event);
-    return 1;
-}
-
-void eventsToNotes(uint16_t ticksPerQN) {
-    noteCount = 0;
-    lastNoteTime = 0.0f;
-    int activeIndex[128];
-    for (int i = 0; i < 128; i++) activeIndex[i] = -1;
-    double currentTime = 0;
-    uint32_t lastTick = 0;
-    uint32_t tempo = 500000;
-
-    for (int i = 0; i < eventCount; i++) {
-        RawEvent *e = &events[i];
-        uint32_t d = e->tick - lastTick;
-        currentTime += (double)d * (double)tempo / ((double)ticksPerQN * 1000000.0);
-        lastTick = e->tick;
-
-        if (e->type == 0) {
-            tempo = e->tempo;
-        } else if (e->type == 1) {
-            int f = e->note - 84;
-            if (noteCount < MAX_NOTES) {
-                notes[noteCount] = (Note){(float)currentTime, f, 0, true, false};
-                activeIndex[e->note] = noteCount;
-                if (notes[noteCount].time > lastNoteTime) lastNoteTime = notes[noteCount].time;
-                noteCount++;
-            }
-        } else if (e->type == 2) {
-            int idx = activeIndex[e->note];
-            if (idx != -1) {
-                float dur = (float)currentTime - notes[idx].time;
-                if (dur < 0) dur = 0;
-                notes[idx].sustain = dur;
-                if (notes[idx].time + dur > lastNoteTime) lastNoteTime = notes[idx].time + dur;
-                activeIndex[e->note] = -1;
-            }
-        }
-    }
-}
-
 // --- VISUAIS ---
 static void DrawScanlines(int screenW, int screenH) {
     for (int y = 0; y < screenH; y += 4) DrawRectangle(0, y, screenW, 1, Fade(BLACK, 0.2f));
@@ -223,42 +80,42 @@ static void DrawScanlines(int screenW, int screenH) {
 
 static void SpawnExplosion(Vector2 pos, Color color) {
     for (int i = 0; i < 20; i++) {
-        particlePoolIndex = (particlePoolIndex + 1) % MAX_PARTICLES;
-        particles[particlePoolIndex] = (Particle){pos, {(float)GetRandomValue(-200, 200), (float)GetRandomValue(-250, 50)}, (GetRandomValue(0, 10) < 5) ? color : WHITE, PARTICLE_LIFE, true};
+        Vector2 vel = {(float)GetRandomValue(-200, 200), (float)GetRandomValue(-250, 50)};
+        ParticleSystem_Emit(&particles, pos, vel, (GetRandomValue(0, 10) < 5) ? color : WHITE, 0.8f);
     }
 }
 static void SpawnMiss(Vector2 pos) {
     for (int i = 0; i < 10; i++) {
-        particlePoolIndex = (particlePoolIndex + 1) % MAX_PARTICLES;
-        particles[particlePoolIndex] = (Particle){(Vector2){pos.x + GetRandomValue(-10,10), pos.y}, {(float)GetRandomValue(-50, 50), (float)GetRandomValue(50, 150)}, RED, 0.5f, true};
+        Vector2 vel = {(float)GetRandomValue(-50, 50), (float)GetRandomValue(50, 150)};
+        ParticleSystem_Emit(&particles, (Vector2){pos.x + GetRandomValue(-10,10), pos.y}, vel, RED, 0.5f);
     }
 }
 static void SpawnSustainSparks(Vector2 pos, Color color) {
-    for (int i = 0; i < 1; i++) {
-        particlePoolIndex = (particlePoolIndex + 1) % MAX_PARTICLES;
-        particles[particlePoolIndex] = (Particle){(Vector2){pos.x + GetRandomValue(-5, 5), pos.y}, {(float)GetRandomValue(-30, 30), (float)GetRandomValue(-100, -200)}, WHITE, 0.3f, true};
-    }
-}
-static void UpdateParticles(float dt) {
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        if (!particles[i].active) continue;
-        particles[i].life -= dt;
-        if (particles[i].life <= 0) {
-            particles[i].active = false;
-            continue;
-        }
-        particles[i].position.x += particles[i].velocity.x * dt;
-        particles[i].position.y += particles[i].velocity.y * dt;
-        particles[i].velocity.y += 400 * dt;
-    }
+    Vector2 vel = {(float)GetRandomValue(-30, 30), (float)GetRandomValue(-100, -200)};
+    ParticleSystem_Emit(&particles, (Vector2){pos.x + GetRandomValue(-5, 5), pos.y}, vel, WHITE, 0.3f);
 }
-static void DrawParticles() {
-    BeginBlendMode(BLEND_ADDITIVE);
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        if (!particles[i].active) continue;
-        DrawRectangleV(particles[i].position, (Vector2){4, 4}, Fade(particles[i].color, particles[i].life));
+
+// Desvios de acerto da partida (toque - nota): verde no centro, vermelho nas bordas
+static void DrawHitHistogram(int x, int y, int width, int height) {
+    const GhHitHistogram *hist = &sim.histogram;
+    if (hist->count == 0) return;
+
+    int peak = 1;
+    for (int i = 0; i < GH_HIST_BINS; i++) if (hist->bins[i] > peak) peak = hist->bins[i];
+
+    float barW = (float)width / GH_HIST_BINS;
+    for (int i = 0; i < GH_HIST_BINS; i++) {
+        if (hist->bins[i] == 0) continue;
+        float barH = (float)height * hist->bins[i] / peak;
+        float centerMs = fabsf(i * GH_HIST_BIN_MS - GH_HIST_RANGE_MS + GH_HIST_BIN_MS * 0.5f);
+        Color c = (centerMs < 35.0f) ? GREEN : (centerMs < 75.0f) ? YELLOW : RED;
+        DrawRectangle(x + (int)(i * barW), y + height - (int)barH, (int)barW - 1, (int)barH, c);
     }
-    EndBlendMode();
+    DrawLine(x + width/2, y, x + width/2, y + height, WHITE);
+    DrawRectangleLines(x, y, width, height, Fade(CYBER_BLUE, 0.5f));
+
+    const char *label = TextFormat("TIMING: %+.1f ms (-%d .. +%d)", hist->sumMs / hist->count, GH_HIST_RANGE_MS, GH_HIST_RANGE_MS);
+    DrawText(label, x + width/2 - MeasureText(label, 20)/2, y + height + 8, 20, GRAY);
 }
 
 // --- GIF ---
@@ -307,23 +164,38 @@ static void UnloadGifCorrect(void) {
 
 // --- FUNÇÃO PÚBLICA 1: INICIALIZAÇÃO ---
 bool GuitarHero_Init(int width, int height) {
-    score = 0; combo = 0; health = 50.0f; ghState = STATE_START;
+    ghState = STATE_START;
+    GhClock_Reset(&songClock);
+    songPosition = 0.0f;
+    if (GhLatency_Load(&latency)) {
+        printf("GuitarHero: latencia calibrada (entrada %.1f ms, saida %.1f ms)\n", latency.inputLatency * 1000.0f, latency.outputLatency * 1000.0f);
+    }
 
-    for (int i = 0; i < MAX_PARTICLES; i++) particles[i].active = false;
     for (int i = 0; i < NUM_FRETS; i++) fret_miss_timer[i] = 0.0f;
 
     // 1. CARREGA MIDI
-    uint16_t ticksPerQN = 480;
     const char* midiPath = "assets/guitar_musics/notes.mid";
     if (!FileExists(midiPath)) midiPath = "assets/notes.mid";
     if (!FileExists(midiPath)) midiPath = "assets/guitar_musics/teste.mid";
     if (!FileExists(midiPath)) midiPath = "assets/teste.mid";
 
-    if (parseMidiFile(midiPath, &ticksPerQN)) {
-        eventsToNotes(ticksPerQN);
-    } else {
-        return false;
-    }
+    // Usa o chart compilado (.ghc) quando ainda bate com o MIDI; senão compila e grava
+    GhChart chart;
+    if (!GhChart_Load(midiPath, &chart)) return false;
+    printf("GuitarHero: %u notas (%s)\n", chart.noteCount, chart.fromCache ? "cache .ghc" : "MIDI compilado");
+    GhSim_Load(&sim, &chart);
+    GhChart_Unload(&chart);
+
+    // Faíscas: gravidade, sem arrasto, quadrados 4x4 com alfa = vida restante
+    ParticleConfig sparks = { .gravity = 400.0f, .drag = 0.0f, .bounded = false, .fadeSeconds = 1.0f,
+                              .shape = PARTICLE_SHAPE_SQUARE, .size = 4.0f };
+    if (!ParticleSystem_Init(&particles, MAX_PARTICLES, sparks)) return false;
+
+    // Entrada com carimbo de tempo: o gh_input passa a controlar o ritmo dos frames
+    for (int i = 0; i < NUM_FRETS; i++) input_keys[i] = key_bindings[i];
+    input_keys[CHEAT_SLOT] = KEY_I;
+    GhInput_Init(input_keys, NUM_FRETS + 1);
+    GhInput_Begin();
 
     // 2. Cálculo das Posições
     current_game_area_start_x = (float)width / 2.0f - (BASE_WIDTH - 2 * GUTTER_WIDTH) / 2.0f;
@@ -336,8 +208,8 @@ bool GuitarHero_Init(int width, int height) {
     for (int i = 0; i < NUM_FRETS; i++) fret_positions[i] = startX + (i * LANE_SPACING);
 
     // 3. Carregamento de Assets
-    if (FileExists("assets/background.jpg")) background = LoadTexture("assets/background.jpg");
-    else if (FileExists("assets/guitar_musics/background.jpg")) background = LoadTexture("assets/guitar_musics/background.jpg");
+    if (FileExists("assets/background.jpg")) background = AssetCache_LoadTexture("assets/background.jpg");
+    else if (FileExists("assets/guitar_musics/background.jpg")) background = AssetCache_LoadTexture("assets/guitar_musics/background.jpg");
 
     // TENTA CARREGAR GIF
     if (FileExists("assets/guitar.gif")) LoadGifCorrect("assets/guitar.gif");
@@ -379,20 +251,25 @@ bool GuitarHero_UpdateDraw(float dt) {
     const float GAME_AREA_WIDTH_CURRENT = current_game_area_width;
 
     // --- UPDATE LOGIC ---
+    GHState stateBefore = ghState;
     if (ghState == STATE_START) {
         if (IsKeyPressed(KEY_SPACE)) {
             ghState = STATE_PLAYING;
+            GhInput_ClearEvents(); // Toques da tela inicial não contam
             if (haveSong) PlayMusicStream(song);
             if (haveVocals) PlayMusicStream(vocals);
+        } else if (IsKeyPressed(KEY_C)) {
+            ghState = STATE_CALIBRATE;
+            GhInput_ClearEvents();
+            GhCalibration_Begin();
         }
-    } else if (ghState == STATE_PLAYING) {
-        // --- BOTÃO DE VITÓRIA AUTOMÁTICA (CHEAT) ---
-        if (IsKeyPressed(KEY_I)) {
-            ghState = STATE_WIN;
-            score += 5000; // Pontos bônus
-            combo += 50;
+    } else if (ghState == STATE_CALIBRATE) {
+        GhCalibration_Update(&latency);
+        if (GhCalibration_IsDone() && IsKeyPressed(KEY_ENTER)) {
+            GhLatency_Save(&latency);
+            ghState = STATE_START;
         }
-
+    } else if (ghState == STATE_PLAYING) {
         if (haveSong) UpdateMusicStream(song);
         if (haveVocals) UpdateMusicStream(vocals);
 
@@ -404,79 +281,52 @@ bool GuitarHero_UpdateDraw(float dt) {
             }
         }
 
-        float currentTime = haveSong ? GetMusicTimePlayed(song) + audioOffset : 0.0f;
-        if (currentTime > lastNoteTime + 3.0f && noteCount > 0) ghState = STATE_WIN;
+        if (haveSong) songPosition = (float)GhClock_Update(&songClock, GetMusicTimePlayed(song), GetTime()) - latency.outputLatency;
+        float currentTime = songPosition;
+        GhInput_SetSongClock(currentTime);
+        GhSim_BeginStep(&sim, currentTime);
         for (int i = 0; i < NUM_FRETS; i++) {
             if (fret_miss_timer[i] > 0) fret_miss_timer[i] -= dt;
         }
 
-        for (int i = 0; i < noteCount; i++) {
-            if (!notes[i].active) continue;
-            if (notes[i].hit) {
-                if (currentTime > notes[i].time + notes[i].sustain) {
-                    notes[i].active = false;
+        // Toques desde o último frame, em ordem, cada um julgado no seu próprio instante
+        GhInputEvent event;
+        while (sim.state == GH_SIM_PLAYING && GhInput_NextEvent(&event)) {
+            if (event.slot == CHEAT_SLOT) {
+                // --- BOTÃO DE VITÓRIA AUTOMÁTICA (CHEAT) ---
+                if (event.down) {
+                    sim.state = GH_SIM_WIN;
+                    sim.score += 5000; // Pontos bônus
+                    sim.combo += 50;
                 }
+            } else if (event.down) {
+                GhSim_Press(&sim, event.slot, event.songTime - latency.inputLatency);
             } else {
-                if ((notes[i].time - currentTime) < -(HIT_WINDOW_MS/1000.0f)) {
-                    notes[i].active = false;
-                    combo = 0;
-                    score -= 50;
-                    if (score < 0) score = 0;
-                    fret_miss_timer[notes[i].fret] = 0.2f;
-                    health -= 5.0f;
-                    if (health <= 0) { health = 0; ghState = STATE_LOSE; }
-                }
+                GhSim_Release(&sim, event.slot, event.songTime - latency.inputLatency);
             }
         }
 
-        for (int i = 0; i < noteCount; i++) {
-            if (!notes[i].active || !notes[i].hit) continue;
-            if (notes[i].sustain > 0) {
-                if (currentTime < notes[i].time + notes[i].sustain) {
-                    if (IsKeyDown(key_bindings[notes[i].fret])) {
-                        score += 100 * dt;
-                        if (GetRandomValue(0,5) == 0) SpawnSustainSparks((Vector2){fret_positions[notes[i].fret], HIT_ZONE_Y_CURRENT}, fret_colors[notes[i].fret]);
-                    } else {
-                        notes[i].active = false;
-                        combo = 0;
-                    }
-                }
-            }
+        bool held[NUM_FRETS];
+        for (int fret = 0; fret < NUM_FRETS; fret++) held[fret] = GhInput_IsDown(fret);
+        GhSim_EndStep(&sim, currentTime, dt, held);
+
+        // Efeitos do que foi julgado neste frame
+        for (int i = 0; i < sim.judgementCount; i++) {
+            const GhJudgement *j = &sim.judgements[i];
+            Vector2 pos = { fret_positions[j->fret], HIT_ZONE_Y_CURRENT };
+            if (j->type == GH_JUDGE_HIT) SpawnExplosion(pos, fret_colors[j->fret]);
+            else if (j->type == GH_JUDGE_OVERSTRUM) { SpawnMiss(pos); fret_miss_timer[j->fret] = 0.3f; }
+            else if (j->type == GH_JUDGE_MISS) fret_miss_timer[j->fret] = 0.2f;
         }
-
         for (int fret = 0; fret < NUM_FRETS; fret++) {
-            if (IsKeyPressed(key_bindings[fret])) {
-                int bestIdx = -1;
-                float bestDiff = (HIT_WINDOW_MS/1000.0f) + 0.001f;
-                for (int i = 0; i < noteCount; i++) {
-                    if (!notes[i].active || notes[i].hit || notes[i].fret != fret) continue;
-                    float diff = fabsf(notes[i].time - currentTime);
-                    if (diff < bestDiff) {
-                        bestDiff = diff;
-                        bestIdx = i;
-                    }
-                }
-                if (bestIdx != -1) {
-                    notes[bestIdx].hit = true;
-                    score += 100 + (combo * 10);
-                    combo++;
-                    SpawnExplosion((Vector2){fret_positions[fret], HIT_ZONE_Y_CURRENT}, fret_colors[fret]);
-                    if (notes[bestIdx].sustain < 0.1f) notes[bestIdx].active = false;
-                    health += 5.0f;
-                    if (health > 100) health = 100;
-                } else {
-                    combo = 0;
-                    score -= 50;
-                    if (score < 0) score = 0;
-                    SpawnMiss((Vector2){fret_positions[fret], HIT_ZONE_Y_CURRENT});
-                    fret_miss_timer[fret] = 0.3f;
-                    health -= 5.0f;
-                    if (health <= 0) { health = 0; ghState = STATE_LOSE; }
-                }
-            }
+            if (sim.sustaining[fret] && GetRandomValue(0,5) == 0) SpawnSustainSparks((Vector2){fret_positions[fret], HIT_ZONE_Y_CURRENT}, fret_colors[fret]);
         }
-        UpdateParticles(dt);
+
+        if (sim.state == GH_SIM_WIN) ghState = STATE_WIN;
+        else if (sim.state == GH_SIM_LOSE) ghState = STATE_LOSE;
+        ParticleSystem_Update(&particles, dt);
     }
+    if (stateBefore == STATE_PLAYING && ghState != STATE_PLAYING) GhSim_PrintHistogram(&sim);
 
     // --- DRAW ---
     BeginDrawing();
@@ -526,35 +376,43 @@ bool GuitarHero_UpdateDraw(float dt) {
         if (fret_miss_timer[i] > 0) DrawText("X", x-10, HIT_ZONE_Y_CURRENT-15, 30, RED);
     }
 
-    float currentTime = haveSong ? GetMusicTimePlayed(song) + audioOffset : 0.0f;
-    for (int i = 0; i < noteCount; i++) {
-        if (!notes[i].active) continue;
-        float dy = (notes[i].time - currentTime) * SPEED;
-        float y = HIT_ZONE_Y_CURRENT - dy;
-        float x = fret_positions[notes[i].fret];
-        Color c = fret_colors[notes[i].fret];
-        if (notes[i].sustain > 0) {
-            float ty = HIT_ZONE_Y_CURRENT - ((notes[i].time + notes[i].sustain - currentTime) * SPEED);
-            float hy = notes[i].hit ? HIT_ZONE_Y_CURRENT : y;
-            if (hy > ty) DrawRectangle(x-5, ty, 10, hy-ty, Fade(c, 0.6f));
-        }
-        if (!notes[i].hit && y < h + 50 && y > -50) {
-            DrawCircle(x, y, 20, c);
-            DrawCircle(x, y, 12, WHITE);
+    float currentTime = songPosition;
+    // Janela visível: da primeira nota ativa de cada faixa até a que ainda está acima do topo da tela
+    const float visibleHorizon = currentTime + (HIT_ZONE_Y_CURRENT + 50.0f) / SPEED;
+    for (int fret = 0; fret < NUM_FRETS; fret++) {
+        const GhFretLane *lane = &sim.lanes[fret];
+        for (int k = lane->firstLive; k < lane->count; k++) {
+            const GhNote *n = GhSim_LaneNote(&sim, fret, k);
+            if (n->time > visibleHorizon) break;
+            if (!n->active) continue;
+            float dy = (n->time - currentTime) * SPEED;
+            float y = HIT_ZONE_Y_CURRENT - dy;
+            float x = fret_positions[n->fret];
+            Color c = fret_colors[n->fret];
+            if (n->sustain > 0) {
+                float ty = HIT_ZONE_Y_CURRENT - ((n->time + n->sustain - currentTime) * SPEED);
+                float hy = n->hit ? HIT_ZONE_Y_CURRENT : y;
+                if (hy > ty) DrawRectangleV((Vector2){x-5, ty}, (Vector2){10, hy-ty}, Fade(c, 0.6f));
+            }
+            if (!n->hit && y < h + 50 && y > -50) {
+                // Posições em float: a nota desce em passos sub-pixel, sem tremer
+                DrawCircleV((Vector2){x, y}, 20, c);
+                DrawCircleV((Vector2){x, y}, 12, WHITE);
+            }
         }
     }
 
-    DrawParticles();
+    ParticleSystem_Draw(&particles);
     DrawScanlines(w, h);
 
     DrawRectangle(0,0,w, 70, BLACK);
     DrawLine(0, 70, w, 70, CYBER_BLUE);
-    DrawText(TextFormat("SCORE: %06d", (int)score), 20, 20, 30, WHITE);
-    DrawText(TextFormat("COMBO: %dx", combo), w-200, 20, 30, combo > 30 ? CYBER_PINK : WHITE);
+    DrawText(TextFormat("SCORE: %06d", (int)sim.score), 20, 20, 30, WHITE);
+    DrawText(TextFormat("COMBO: %dx", sim.combo), w-200, 20, 30, sim.combo > 30 ? CYBER_PINK : WHITE);
     float barW = 400; float barX = (w-barW)/2;
     DrawRectangleLines(barX, 25, barW, 20, WHITE);
-    Color hc = health > 50 ? GREEN : (health > 25 ? YELLOW : RED);
-    DrawRectangle(barX+2, 27, (barW-4) * (health / 100.0f), 16, hc);
+    Color hc = sim.health > 50 ? GREEN : (sim.health > 25 ? YELLOW : RED);
+    DrawRectangle(barX+2, 27, (barW-4) * (sim.health / 100.0f), 16, hc);
 
     if (ghState == STATE_START) {
         DrawRectangle(0, 0, w, h, Fade(BLACK, 0.6f));
@@ -573,8 +431,12 @@ bool GuitarHero_UpdateDraw(float dt) {
         if (((int)(GetTime() * 2)) % 2 == 0) {
             DrawText("PRESS [SPACE] TO START", w/2 - MeasureText("PRESS [SPACE] TO START", 30)/2, h - 150, 30, CYBER_PINK);
         }
+        const char *calMsg = TextFormat("[C] CALIBRATE  (INPUT %.0f ms / AUDIO %.0f ms)", latency.inputLatency * 1000.0f, latency.outputLatency * 1000.0f);
+        DrawText(calMsg, w/2 - MeasureText(calMsg, 20)/2, h - 100, 20, GRAY);
     }
 
+    if (ghState == STATE_CALIBRATE) GhCalibration_Draw(w, h, HIT_ZONE_Y_CURRENT);
+
     // --- TELA DE VITÓRIA OU DERROTA ATUALIZADA ---
     if (ghState == STATE_WIN || ghState == STATE_LOSE) {
         DrawRectangle(0,0,w,h, Fade(BLACK, 0.85f));
@@ -594,13 +456,15 @@ bool GuitarHero_UpdateDraw(float dt) {
             DrawText(lore3, w/2 - MeasureText(lore3, loreSize)/2, h/2 + 40, loreSize, WHITE);
 
             // Pontuação um pouco mais para baixo
-            DrawText(TextFormat("FINAL SCORE: %d", (int)score), w/2 - MeasureText(TextFormat("FINAL SCORE: %d", (int)score), 30)/2, h/2 + 90, 30, YELLOW);
+            DrawText(TextFormat("FINAL SCORE: %d", (int)sim.score), w/2 - MeasureText(TextFormat("FINAL SCORE: %d", (int)sim.score), 30)/2, h/2 + 90, 30, YELLOW);
         } else {
             const char* msg = "FAILED";
             DrawText(msg, w/2 - MeasureText(msg, 60)/2, h/2 - 30, 60, RED);
-            DrawText(TextFormat("FINAL SCORE: %d", (int)score), w/2 - MeasureText(TextFormat("FINAL SCORE: %d", (int)score), 30)/2, h/2 + 50, 30, WHITE);
+            DrawText(TextFormat("FINAL SCORE: %d", (int)sim.score), w/2 - MeasureText(TextFormat("FINAL SCORE: %d", (int)sim.score), 30)/2, h/2 + 50, 30, WHITE);
         }
 
+        DrawHitHistogram(w/2 - 240, h - 190, 480, 80);
+
         // --- LÓGICA DE VOLTAR AO LOBBY ---
         const char* exitMsg = "PRESS [ENTER] TO RETURN";
         DrawText(exitMsg, w/2 - MeasureText(exitMsg, 20)/2, h/2 + 150, 20, GRAY);
@@ -612,13 +476,21 @@ bool GuitarHero_UpdateDraw(float dt) {
     }
 
     EndDrawing();
+    // Espera o próximo frame lendo o teclado a cada ~1 ms enquanto a música toca (ou a
+    // calibração coleta toques). Terminada a calibração a leitura volta a ser uma por frame,
+    // senão o IsKeyPressed(KEY_ENTER) da tela de salvar quase nunca veria o aperto
+    bool capture = (ghState == STATE_PLAYING) || (ghState == STATE_CALIBRATE && !GhCalibration_IsDone());
+    GhInput_EndFrame(capture);
     return true; // Continua no jogo
 }
 
 // --- FUNÇÃO PÚBLICA 3: DESCARREGAMENTO ---
 void GuitarHero_Unload(void) {
+    GhInput_End();
+    GhCalibration_Unload();
+    ParticleSystem_Unload(&particles);
     if (haveSong) UnloadMusicStream(song);
     if (haveVocals) UnloadMusicStream(vocals);
     UnloadGifCorrect();
-    if (background.id > 0) UnloadTexture(background);
+    if (background.id > 0) AssetCache_UnloadTexture(background);
 }
\ No newline at end of file
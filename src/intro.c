@@ -3,6 +3,8 @@
 #include <video_player.h>
 #include <raylib.h>
 
+#define INTRO_SEEK_STEP 5.0f
+
 bool Intro_Play(VideoPlayer *vp, int width, int height, const char *framesPath, int frameCount, float fps, const char *audioPath, float loadingTime) {
     if (!VideoPlayer_Init(vp, framesPath, frameCount, fps, audioPath)) return false;
 
@@ -10,6 +12,11 @@ bool Intro_Play(VideoPlayer *vp, int width, int height, const char *framesPath,
 
     // Loop do vídeo
     while (!WindowShouldClose() && !VideoPlayer_IsFinished(vp)) {
+        // Controles: ENTER pula a intro, setas voltam/avançam alguns segundos
+        if (IsKeyPressed(KEY_ENTER)) break;
+        if (IsKeyPressed(KEY_RIGHT)) VideoPlayer_Seek(vp, VideoPlayer_GetTime(vp) + INTRO_SEEK_STEP);
+        if (IsKeyPressed(KEY_LEFT)) VideoPlayer_Seek(vp, VideoPlayer_GetTime(vp) - INTRO_SEEK_STEP);
+
         float delta = GetFrameTime();
         VideoPlayer_Update(vp, delta);
 
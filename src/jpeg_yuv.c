@@ -0,0 +1,464 @@
+#include "jpeg_yuv.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- ESTRUTURAS DO DECODIFICADOR ---
+#define HUFF_FAST_BITS 9
+
+typedef struct {
+    uint16_t fast[1 << HUFF_FAST_BITS]; // (tamanho << 8) | símbolo; 0 = código mais longo que HUFF_FAST_BITS
+    uint8_t symbols[256];
+    int32_t maxCode[18];                // Maior código de cada tamanho (-1 = nenhum)
+    int32_t valOffset[17];              // Índice em 'symbols' do primeiro código de cada tamanho - esse código
+    bool present;
+} HuffTable;
+
+typedef struct {
+    int id;
+    int h, v;           // Fatores de amostragem
+    int quant;          // Tabela de quantização
+    int dcTable, acTable;
+    int dcPred;
+} JpegComponent;
+
+typedef struct {
+    const uint8_t *data;
+    const uint8_t *end;
+    const uint8_t *scan;    // Início dos dados comprimidos (após o SOS)
+
+    uint16_t quant[4][64];  // Em ordem zigue-zague, como no arquivo
+    HuffTable dc[4];
+    HuffTable ac[4];
+
+    JpegComponent comp[3];
+    int width, height;
+    int hmax, vmax;
+    int restartInterval;
+} JpegDecoder;
+
+typedef struct {
+    const uint8_t *p;
+    const uint8_t *end;
+    uint32_t bits;      // Bits pendentes alinhados à esquerda
+    int count;
+    bool marker;        // Encontrou um marcador: passa a injetar zeros
+} BitReader;
+
+// Posição natural de cada coeficiente na ordem zigue-zague
+static const uint8_t zigzag[64] = {
+     0,  1,  8, 16,  9,  2,  3, 10,
+    17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34,
+    27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36,
+    29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46,
+    53, 60, 61, 54, 47, 55, 62, 63
+};
+
+static int Read16(const uint8_t *p) {
+    return (p[0] << 8) | p[1];
+}
+
+// --- CABEÇALHOS ---
+static bool BuildHuffTable(HuffTable *table, const uint8_t *counts, const uint8_t *symbols, int total) {
+    memset(table, 0, sizeof(*table));
+    memcpy(table->symbols, symbols, (size_t)total);
+
+    int code = 0;
+    int k = 0;
+    for (int len = 1; len <= 16; len++) {
+        table->valOffset[len] = k - code;
+        for (int i = 0; i < counts[len - 1]; i++, k++, code++) {
+            // Códigos curtos ocupam todas as entradas da tabela rápida que começam com eles
+            if (len <= HUFF_FAST_BITS) {
+                int shift = HUFF_FAST_BITS - len;
+                for (int j = 0; j < (1 << shift); j++) {
+                    table->fast[(code << shift) | j] = (uint16_t)((len << 8) | symbols[k]);
+                }
+            }
+        }
+        table->maxCode[len] = counts[len - 1] ? code - 1 : -1;
+        if (code > (1 << len)) return false; // Tabela inválida
+        code <<= 1;
+    }
+    table->maxCode[17] = INT32_MAX;
+    table->present = true;
+    return true;
+}
+
+static bool ParseHeaders(JpegDecoder *jd, const uint8_t *data, int size) {
+    memset(jd, 0, sizeof(*jd));
+    jd->data = data;
+    jd->end = data + size;
+
+    if (size < 4 || data[0] != 0xFF || data[1] != 0xD8) return false;
+
+    const uint8_t *p = data + 2;
+    bool haveFrame = false;
+
+    while (p + 4 <= jd->end) {
+        if (p[0] != 0xFF) return false;
+        int marker = p[1];
+        if (marker == 0xFF) { p++; continue; } // Bytes de preenchimento
+
+        int length = Read16(p + 2);
+        const uint8_t *seg = p + 4;
+        const uint8_t *segEnd = p + 2 + length;
+        if (length < 2 || segEnd > jd->end) return false;
+
+        switch (marker) {
+            case 0xDB: { // DQT
+                while (seg < segEnd) {
+                    int precision = seg[0] >> 4;
+                    int id = seg[0] & 15;
+                    int bytes = precision ? 129 : 65;
+                    if (id > 3 || seg + bytes > segEnd) return false;
+                    for (int i = 0; i < 64; i++) {
+                        jd->quant[id][i] = precision ? (uint16_t)Read16(seg + 1 + i * 2) : seg[1 + i];
+                    }
+                    seg += bytes;
+                }
+            } break;
+
+            case 0xC4: { // DHT
+                while (seg < segEnd) {
+                    if (seg + 17 > segEnd) return false;
+                    int tableClass = seg[0] >> 4;
+                    int id = seg[0] & 15;
+                    int total = 0;
+                    for (int i = 0; i < 16; i++) total += seg[1 + i];
+                    if (id > 3 || tableClass > 1 || total > 256 || seg + 17 + total > segEnd) return false;
+
+                    HuffTable *table = tableClass ? &jd->ac[id] : &jd->dc[id];
+                    if (!BuildHuffTable(table, seg + 1, seg + 17, total)) return false;
+                    seg += 17 + total;
+                }
+            } break;
+
+            case 0xC0: case 0xC1: { // SOF0/SOF1: baseline / sequencial estendido (Huffman)
+                if (length < 17 || seg[0] != 8 || seg[5] != 3) return false;
+                jd->height = Read16(seg + 1);
+                jd->width = Read16(seg + 3);
+                if (jd->width <= 0 || jd->height <= 0) return false;
+
+                for (int i = 0; i < 3; i++) {
+                    const uint8_t *c = seg + 6 + i * 3;
+                    jd->comp[i].id = c[0];
+                    jd->comp[i].h = c[1] >> 4;
+                    jd->comp[i].v = c[1] & 15;
+                    jd->comp[i].quant = c[2] & 3;
+                }
+
+                // Y pode ter 1x1, 2x1, 1x2 ou 2x2; o croma precisa ser 1x1 (4:4:4, 4:2:2, 4:4:0, 4:2:0)
+                JpegComponent *y = &jd->comp[0];
+                if (y->h < 1 || y->h > 2 || y->v < 1 || y->v > 2) return false;
+                for (int i = 1; i < 3; i++) {
+                    if (jd->comp[i].h != 1 || jd->comp[i].v != 1) return false;
+                }
+                jd->hmax = y->h;
+                jd->vmax = y->v;
+                haveFrame = true;
+            } break;
+
+            case 0xC2: case 0xC3: case 0xC5: case 0xC6: case 0xC7:
+            case 0xC9: case 0xCA: case 0xCB: case 0xCD: case 0xCE: case 0xCF:
+                return false; // Progressivo, lossless ou aritmético
+
+            case 0xDD: // DRI
+                if (length < 4) return false;
+                jd->restartInterval = Read16(seg);
+                break;
+
+            case 0xDA: { // SOS: cabeçalhos completos, os dados vêm logo depois
+                if (!haveFrame || seg[0] != 3 || length < 12) return false;
+                for (int i = 0; i < 3; i++) {
+                    const uint8_t *c = seg + 1 + i * 2;
+                    if (c[0] != jd->comp[i].id) return false; // Scan precisa ser intercalado na ordem do SOF
+                    jd->comp[i].dcTable = c[1] >> 4;
+                    jd->comp[i].acTable = c[1] & 15;
+                    if (jd->comp[i].dcTable > 3 || jd->comp[i].acTable > 3) return false;
+                    if (!jd->dc[jd->comp[i].dcTable].present || !jd->ac[jd->comp[i].acTable].present) return false;
+                }
+                jd->scan = segEnd;
+                return true;
+            }
+
+            default: // APPn, COM e outros segmentos ignorados
+                break;
+        }
+        p = segEnd;
+    }
+
+    return false;
+}
+
+// --- LEITURA DE BITS / HUFFMAN ---
+static void FillBits(BitReader *br) {
+    while (br->count <= 24) {
+        uint32_t byte = 0;
+        if (!br->marker && br->p < br->end) {
+            byte = *br->p;
+            if (byte == 0xFF) {
+                uint32_t next = (br->p + 1 < br->end) ? br->p[1] : 0xD9;
+                if (next == 0x00) {
+                    br->p += 2; // 0xFF00 = byte 0xFF literal
+                } else {
+                    br->marker = true;
+                    byte = 0;
+                }
+            } else {
+                br->p++;
+            }
+        }
+        br->bits |= byte << (24 - br->count);
+        br->count += 8;
+    }
+}
+
+static int GetBits(BitReader *br, int n) {
+    if (n == 0) return 0;
+    FillBits(br);
+    int value = (int)(br->bits >> (32 - n));
+    br->bits <<= n;
+    br->count -= n;
+    return value;
+}
+
+// Converte os 'n' bits lidos em um valor com sinal (tabela F.12 da especificação)
+static int Extend(int value, int n) {
+    return (value < (1 << (n - 1))) ? value - (1 << n) + 1 : value;
+}
+
+static int DecodeHuffman(BitReader *br, const HuffTable *table) {
+    FillBits(br);
+
+    int entry = table->fast[br->bits >> (32 - HUFF_FAST_BITS)];
+    if (entry) {
+        int len = entry >> 8;
+        br->bits <<= len;
+        br->count -= len;
+        return entry & 255;
+    }
+
+    for (int len = HUFF_FAST_BITS + 1; len <= 16; len++) {
+        int code = (int)(br->bits >> (32 - len));
+        if (code <= table->maxCode[len]) {
+            br->bits <<= len;
+            br->count -= len;
+            return table->symbols[table->valOffset[len] + code];
+        }
+    }
+    return -1; // Código inexistente: dados corrompidos
+}
+
+// --- IDCT ---
+// IDCT inteira separável (mesmo algoritmo do "islow" da libjpeg), saída já com +128 e saturada
+#define CONST_BITS 13
+#define PASS1_BITS 2
+#define DESCALE(x, n) (((x) + (1 << ((n) - 1))) >> (n))
+
+#define FIX_0_298631336  2446
+#define FIX_0_390180644  3196
+#define FIX_0_541196100  4433
+#define FIX_0_765366865  6270
+#define FIX_0_899976223  7373
+#define FIX_1_175875602  9633
+#define FIX_1_501321110  12299
+#define FIX_1_847759065  15137
+#define FIX_1_961570560  16069
+#define FIX_2_053119869  16819
+#define FIX_2_562915447  20995
+#define FIX_3_072711026  25172
+
+#define IDCT_1D(s0, s1, s2, s3, s4, s5, s6, s7) \
+    int32_t z1 = ((s2) + (s6)) * FIX_0_541196100; \
+    int32_t t2 = z1 - (s6) * FIX_1_847759065; \
+    int32_t t3 = z1 + (s2) * FIX_0_765366865; \
+    int32_t t0 = ((s0) + (s4)) * (1 << CONST_BITS); \
+    int32_t t1 = ((s0) - (s4)) * (1 << CONST_BITS); \
+    int32_t e10 = t0 + t3, e13 = t0 - t3, e11 = t1 + t2, e12 = t1 - t2; \
+    int32_t o0 = (s7), o1 = (s5), o2 = (s3), o3 = (s1); \
+    int32_t za = o0 + o3, zb = o1 + o2, zc = o0 + o2, zd = o1 + o3; \
+    int32_t z5 = (zc + zd) * FIX_1_175875602; \
+    o0 *= FIX_0_298631336; o1 *= FIX_2_053119869; o2 *= FIX_3_072711026; o3 *= FIX_1_501321110; \
+    za *= -FIX_0_899976223; zb *= -FIX_2_562915447; zc *= -FIX_1_961570560; zd *= -FIX_0_390180644; \
+    zc += z5; zd += z5; \
+    o0 += za + zc; o1 += zb + zd; o2 += zb + zc; o3 += za + zd;
+
+static uint8_t Clamp255(int32_t x) {
+    return (uint8_t)(x < 0 ? 0 : (x > 255 ? 255 : x));
+}
+
+static void InverseDCT(const int16_t *in, uint8_t *out, int stride) {
+    int32_t ws[64];
+
+    // Colunas
+    for (int c = 0; c < 8; c++) {
+        const int16_t *col = in + c;
+        if (!col[8] && !col[16] && !col[24] && !col[32] && !col[40] && !col[48] && !col[56]) {
+            int32_t dc = col[0] * (1 << PASS1_BITS);
+            for (int r = 0; r < 8; r++) ws[r * 8 + c] = dc;
+            continue;
+        }
+
+        IDCT_1D(col[0], col[8], col[16], col[24], col[32], col[40], col[48], col[56])
+        const int n = CONST_BITS - PASS1_BITS;
+        ws[0 * 8 + c] = DESCALE(e10 + o3, n);
+        ws[7 * 8 + c] = DESCALE(e10 - o3, n);
+        ws[1 * 8 + c] = DESCALE(e11 + o2, n);
+        ws[6 * 8 + c] = DESCALE(e11 - o2, n);
+        ws[2 * 8 + c] = DESCALE(e12 + o1, n);
+        ws[5 * 8 + c] = DESCALE(e12 - o1, n);
+        ws[3 * 8 + c] = DESCALE(e13 + o0, n);
+        ws[4 * 8 + c] = DESCALE(e13 - o0, n);
+    }
+
+    // Linhas
+    for (int r = 0; r < 8; r++) {
+        const int32_t *row = ws + r * 8;
+        uint8_t *dst = out + r * stride;
+
+        if (!row[1] && !row[2] && !row[3] && !row[4] && !row[5] && !row[6] && !row[7]) {
+            uint8_t dc = Clamp255(DESCALE(row[0], PASS1_BITS + 3) + 128);
+            memset(dst, dc, 8);
+            continue;
+        }
+
+        IDCT_1D(row[0], row[1], row[2], row[3], row[4], row[5], row[6], row[7])
+        const int n = CONST_BITS + PASS1_BITS + 3;
+        const int32_t bias = 128 << n; // Desloca de volta para 0..255 antes do DESCALE
+        dst[0] = Clamp255(DESCALE(e10 + o3 + bias, n));
+        dst[7] = Clamp255(DESCALE(e10 - o3 + bias, n));
+        dst[1] = Clamp255(DESCALE(e11 + o2 + bias, n));
+        dst[6] = Clamp255(DESCALE(e11 - o2 + bias, n));
+        dst[2] = Clamp255(DESCALE(e12 + o1 + bias, n));
+        dst[5] = Clamp255(DESCALE(e12 - o1 + bias, n));
+        dst[3] = Clamp255(DESCALE(e13 + o0 + bias, n));
+        dst[4] = Clamp255(DESCALE(e13 - o0 + bias, n));
+    }
+}
+
+// --- DECODIFICAÇÃO ---
+static bool DecodeBlock(JpegDecoder *jd, BitReader *br, JpegComponent *c, uint8_t *out, int stride) {
+    int16_t coef[64];
+    memset(coef, 0, sizeof(coef));
+    const uint16_t *q = jd->quant[c->quant];
+
+    int t = DecodeHuffman(br, &jd->dc[c->dcTable]);
+    if (t < 0 || t > 11) return false;
+    c->dcPred += t ? Extend(GetBits(br, t), t) : 0;
+    coef[0] = (int16_t)(c->dcPred * q[0]);
+
+    const HuffTable *ac = &jd->ac[c->acTable];
+    bool dcOnly = true;
+    for (int k = 1; k < 64;) {
+        int rs = DecodeHuffman(br, ac);
+        if (rs < 0) return false;
+        int run = rs >> 4;
+        int s = rs & 15;
+
+        if (s == 0) {
+            if (run != 15) break; // EOB
+            k += 16;              // ZRL: 16 zeros
+            continue;
+        }
+        k += run;
+        if (k > 63) return false;
+        coef[zigzag[k]] = (int16_t)(Extend(GetBits(br, s), s) * q[k]);
+        dcOnly = false;
+        k++;
+    }
+
+    // Blocos lisos são muito comuns no vídeo: só o DC, sem IDCT
+    if (dcOnly) {
+        uint8_t dc = Clamp255(DESCALE(coef[0] * (1 << PASS1_BITS), PASS1_BITS + 3) + 128);
+        for (int r = 0; r < 8; r++) memset(out + r * stride, dc, 8);
+        return true;
+    }
+
+    InverseDCT(coef, out, stride);
+    return true;
+}
+
+// Pula o marcador RSTn e zera o estado do decodificador de entropia
+static void Restart(JpegDecoder *jd, BitReader *br) {
+    const uint8_t *p = br->p;
+    while (p + 1 < br->end && !(p[0] == 0xFF && p[1] >= 0xD0 && p[1] <= 0xD7)) p++;
+    br->p = (p + 1 < br->end) ? p + 2 : br->end;
+    br->bits = 0;
+    br->count = 0;
+    br->marker = false;
+    for (int i = 0; i < 3; i++) jd->comp[i].dcPred = 0;
+}
+
+bool JpegYuv_IsSupported(const unsigned char *data, int size) {
+    JpegDecoder jd;
+    return data && ParseHeaders(&jd, data, size);
+}
+
+bool JpegYuv_Decode(const unsigned char *data, int size, YuvImage *out) {
+    memset(out, 0, sizeof(*out));
+
+    JpegDecoder jd;
+    if (!data || !ParseHeaders(&jd, data, size)) return false;
+
+    int mcuWidth = 8 * jd.hmax;
+    int mcuHeight = 8 * jd.vmax;
+    int mcusX = (jd.width + mcuWidth - 1) / mcuWidth;
+    int mcusY = (jd.height + mcuHeight - 1) / mcuHeight;
+
+    // Planos alinhados ao MCU: todos cobrem a mesma área, então a GPU usa a mesma UV nos três
+    size_t total = 0;
+    for (int i = 0; i < 3; i++) {
+        out->planeWidth[i] = mcusX * jd.comp[i].h * 8;
+        out->planeHeight[i] = mcusY * jd.comp[i].v * 8;
+        total += (size_t)out->planeWidth[i] * (size_t)out->planeHeight[i];
+    }
+
+    out->data = (unsigned char *)malloc(total);
+    if (!out->data) return false;
+    out->planes[0] = out->data;
+    out->planes[1] = out->planes[0] + out->planeWidth[0] * out->planeHeight[0];
+    out->planes[2] = out->planes[1] + out->planeWidth[1] * out->planeHeight[1];
+    out->width = jd.width;
+    out->height = jd.height;
+
+    BitReader br = { jd.scan, jd.end, 0, 0, false };
+    int mcusLeft = jd.restartInterval;
+
+    for (int my = 0; my < mcusY; my++) {
+        for (int mx = 0; mx < mcusX; mx++) {
+            if (jd.restartInterval) {
+                if (mcusLeft == 0) {
+                    Restart(&jd, &br);
+                    mcusLeft = jd.restartInterval;
+                }
+                mcusLeft--;
+            }
+
+            for (int i = 0; i < 3; i++) {
+                JpegComponent *c = &jd.comp[i];
+                int stride = out->planeWidth[i];
+                for (int by = 0; by < c->v; by++) {
+                    for (int bx = 0; bx < c->h; bx++) {
+                        int px = (mx * c->h + bx) * 8;
+                        int py = (my * c->v + by) * 8;
+                        if (!DecodeBlock(&jd, &br, c, out->planes[i] + py * stride + px, stride)) {
+                            JpegYuv_Unload(out);
+                            return false;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+void JpegYuv_Unload(YuvImage *image) {
+    free(image->data);
+    memset(image, 0, sizeof(*image));
+}
@@ -12,6 +12,8 @@
 #include "game.h"        // Lobby
 #include "guitar_hero.h" // Minigame 1
 #include "byte2.h"  // Minigame 2 (Crie este .h se não tiver)
+#include "asset_prefetch.h"
+#include "asset_cache.h"
 
 // Definindo as variáveis globais que o game.c usa como 'extern'
 bool level1Completed = false;
@@ -32,10 +34,15 @@ int main(void) {
     // 1. Inicialização do Sistema (Audio e Janela iniciados aqui)
     System_Init("Insert Your Soul", &width, &height);
 
-    // 2. Intro
+    // Decodifica as imagens do menu, lobby e minigames em background durante a intro e o menu
+    AssetPrefetch_Start();
+
+    // 2. Intro (usa o pack que o build gera com o tools/pack_video; sem ele, os JPEGs soltos)
     VideoPlayer vp;
+    const char *introFrames = FileExists("assets/frames/intro.vpk") ? "assets/frames/intro.vpk"
+                                                                    : "assets/frames/intro/frame_%04d.jpg";
     if (!Intro_Play(&vp, width, height,
-                    "assets/frames/intro/frame_%04d.jpg",
+                    introFrames,
                     793,
                     60.0f,
                     "assets/audio/intro_audio.wav",
@@ -48,7 +55,6 @@ int main(void) {
 
     AppState state = STATE_MENU;
     bool exitProgram = false;
-    float loadingTimer = 0.0f;
 
     while (!WindowShouldClose() && !exitProgram) {
         float deltaTime = GetFrameTime();
@@ -62,24 +68,28 @@ int main(void) {
 
                 if (action == MENU_ACTION_START || action == MENU_ACTION_CONTINUE) {
                     state = STATE_LOADING_LOBBY;
-                    loadingTimer = 0.0f;
                 } else if (action == MENU_ACTION_EXIT) {
                     exitProgram = true;
                 }
                 break;
 
             // --- TELA DE CARREGAMENTO ---
-            case STATE_LOADING_LOBBY:
-                loadingTimer += deltaTime;
+            case STATE_LOADING_LOBBY: {
+                // Espera o progresso real do pré-carregamento do lobby (normalmente já terminou no menu)
+                PrefetchProgress progress = AssetPrefetch_GetProgress(PREFETCH_LOBBY);
+                float ratio = (progress.bytesTotal > 0) ? (float)progress.bytesDone / progress.bytesTotal : 1.0f;
+                if (progress.itemsTotal > 0 && progress.itemsDone >= progress.itemsTotal) ratio = 1.0f;
 
                 BeginDrawing();
                 ClearBackground(BLACK);
                 DrawText("CARREGANDO...", width/2 - 60, height/2, 20, WHITE);
-                // Animação simples
-                DrawCircle(width/2 + (int)(sin(GetTime()*5)*50), height/2 + 40, 10, WHITE);
+                // Barra de progresso
+                DrawRectangleLines(width/2 - 100, height/2 + 30, 200, 12, WHITE);
+                DrawRectangle(width/2 - 98, height/2 + 32, (int)(196 * ratio), 8, WHITE);
+                DrawText(TextFormat("%d/%d", progress.itemsDone, progress.itemsTotal), width/2 - 15, height/2 + 50, 10, GRAY);
                 EndDrawing();
 
-                if (loadingTimer >= 1.0f) {
+                if (AssetPrefetch_IsGroupDone(PREFETCH_LOBBY)) {
                     if (Game_Init(width, height)) {
                         state = STATE_LOBBY;
                     } else {
@@ -88,6 +98,7 @@ int main(void) {
                     }
                 }
                 break;
+            }
 
             // --- LOBBY / CASA ---
             case STATE_LOBBY: {
@@ -184,7 +195,10 @@ int main(void) {
     if (state == STATE_GUITAR_HERO) GuitarHero_Unload();
     if (state == STATE_BYTE_SPACE) ByteSpace_Unload(); // Limpeza segura
 
+    ByteSpace_Shutdown();
     Menu_Unload();
+    AssetPrefetch_Shutdown();
+    AssetCache_Shutdown();
     System_Close();
 
     return 0;
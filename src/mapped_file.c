@@ -0,0 +1,84 @@
+#include <mapped_file.h>
+
+// Este arquivo não inclui raylib.h: windows.h conflita com vários nomes da raylib
+// (mesma situação de system_config.c).
+
+#if defined(_WIN32) || defined(_WIN64)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+bool MappedFile_Open(MappedFile *file, const char *path) {
+    file->data = NULL;
+    file->size = 0;
+    file->handle = NULL;
+
+    HANDLE fh = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (fh == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(fh, &size) || size.QuadPart == 0) {
+        CloseHandle(fh);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(fh, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(fh); // O mapeamento mantém o arquivo aberto
+    if (!mapping) return false;
+
+    const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    file->data = (const unsigned char *)view;
+    file->size = (size_t)size.QuadPart;
+    file->handle = mapping;
+    return true;
+}
+
+void MappedFile_Close(MappedFile *file) {
+    if (file->data) UnmapViewOfFile(file->data);
+    if (file->handle) CloseHandle((HANDLE)file->handle);
+    file->data = NULL;
+    file->size = 0;
+    file->handle = NULL;
+}
+
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+bool MappedFile_Open(MappedFile *file, const char *path) {
+    file->data = NULL;
+    file->size = 0;
+    file->handle = NULL;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+
+    void *view = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // O mapeamento mantém o arquivo aberto
+    if (view == MAP_FAILED) return false;
+
+    file->data = (const unsigned char *)view;
+    file->size = (size_t)st.st_size;
+    return true;
+}
+
+void MappedFile_Close(MappedFile *file) {
+    if (file->data) munmap((void *)file->data, file->size);
+    file->data = NULL;
+    file->size = 0;
+    file->handle = NULL;
+}
+
+#endif
@@ -6,6 +6,7 @@
 #include <stdbool.h>
 #include <credits.h>
 #include "video_player.h"
+#include "asset_cache.h"
 
 #define NUM_FRAMES 10
 #define BUTTON_COUNT 5
@@ -35,6 +36,7 @@ static bool showContinuePopup = false;
 static bool showExitPopup = false;
 
 static VideoPlayer vpMenu;
+#define MENU_VIDEO_CACHE_BYTES (48u * 1024u * 1024u)
 
 static void DrawPopup(Rectangle popup, const char* message, Rectangle btnYes, Rectangle btnNo, Vector2 mouse, int fontSize) {
     DrawRectangleRec(popup, Fade(DARKGRAY, 0.9f));
@@ -59,15 +61,15 @@ void Menu_Init(int width, int height) {
     char path[64];
     for (int i = 0; i < NUM_FRAMES; i++) {
         sprintf(path, "assets/character/frame%d.png", i+1);
-        characterFrames[i] = LoadTexture(path);
+        characterFrames[i] = AssetCache_LoadTexture(path);
     }
 
     menuMusic = LoadMusicStream("assets/audio/menu_song.ogg");
     SetMusicVolume(menuMusic, 0.6f);
     PlayMusicStream(menuMusic);
 
-    hoverSound = LoadSound("assets/audio/hover.wav");
-    clickSound = LoadSound("assets/audio/click.wav");
+    hoverSound = AssetCache_LoadSound("assets/audio/hover.wav");
+    clickSound = AssetCache_LoadSound("assets/audio/click.wav");
 
     int spacing = screenWidth / 50;
     int buttonWidth = screenWidth / 7;
@@ -82,7 +84,12 @@ void Menu_Init(int width, int height) {
         btnHovered[i] = false;
     }
 
-    VideoPlayer_Init(&vpMenu, "assets/frames/menu/frame_%04d.jpg", 1600, 30.0f, NULL);
+    const char *menuFrames = FileExists("assets/frames/menu.vpk") ? "assets/frames/menu.vpk"
+                                                                  : "assets/frames/menu/frame_%04d.jpg";
+    if (VideoPlayer_Init(&vpMenu, menuFrames, 1600, 30.0f, NULL)) {
+        // O vídeo do menu fica em loop: a partir da 2ª volta os frames saem da RAM (~35 MB de JPEG)
+        VideoPlayer_EnableCache(&vpMenu, MENU_VIDEO_CACHE_BYTES);
+    }
 }
 
 MenuAction Menu_UpdateDraw(float deltaTime) {
@@ -199,10 +206,10 @@ MenuAction Menu_UpdateDraw(float deltaTime) {
 }
 
 void Menu_Unload(void) {
-    for (int i = 0; i < NUM_FRAMES; i++) UnloadTexture(characterFrames[i]);
+    for (int i = 0; i < NUM_FRAMES; i++) AssetCache_UnloadTexture(characterFrames[i]);
     StopMusicStream(menuMusic);
     UnloadMusicStream(menuMusic);
-    UnloadSound(hoverSound);
-    UnloadSound(clickSound);
+    AssetCache_UnloadSound(hoverSound);
+    AssetCache_UnloadSound(clickSound);
     VideoPlayer_Unload(&vpMenu);
 }
@@ -0,0 +1,167 @@
+#include "particles.h"
+#include <float.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Sprite gerado para as partículas redondas: disco branco sólido até SPRITE_CORE do raio,
+// sumindo até a borda. Desenhado com raio size * SPRITE_SCALE para que a parte visível
+// fique do tamanho do antigo DrawCircleV de raio size
+#define SPRITE_SIZE 32
+#define SPRITE_CORE 0.5f
+#define SPRITE_SCALE 1.5f
+
+// Capacidade arredondada para 8 floats (32 bytes, um registrador AVX): todos os arrays
+// do bloco ficam com o mesmo alinhamento do malloc
+#define PARTICLE_ALIGN 8
+
+// --- MEMÓRIA ---
+bool ParticleSystem_Init(ParticleSystem *system, int capacity, ParticleConfig config) {
+    memset(system, 0, sizeof(*system));
+    system->config = config;
+    if (capacity <= 0) return false;
+
+    size_t stride = (size_t)((capacity + PARTICLE_ALIGN - 1) / PARTICLE_ALIGN * PARTICLE_ALIGN);
+    // 5 arrays de float + 1 de Color (4 bytes cada)
+    float *block = (float *)calloc(stride * 6, sizeof(float));
+    if (!block) {
+        printf("ERRO: Sem memoria para %d particulas.\n", capacity);
+        return false;
+    }
+
+    system->posX = block;
+    system->posY = system->posX + stride;
+    system->velX = system->posY + stride;
+    system->velY = system->velX + stride;
+    system->life = system->velY + stride;
+    system->color = (Color *)(system->life + stride);
+    system->capacity = capacity;
+
+    if (IsWindowReady()) {
+        Image image = (config.shape == PARTICLE_SHAPE_CIRCLE)
+            ? GenImageGradientRadial(SPRITE_SIZE, SPRITE_SIZE, SPRITE_CORE, WHITE, BLANK)
+            : GenImageColor(1, 1, WHITE);
+        system->sprite = LoadTextureFromImage(image);
+        UnloadImage(image);
+        SetTextureFilter(system->sprite, TEXTURE_FILTER_BILINEAR);
+    }
+    return true;
+}
+
+void ParticleSystem_Unload(ParticleSystem *system) {
+    if (system->sprite.id > 0) UnloadTexture(system->sprite);
+    free(system->posX);
+    memset(system, 0, sizeof(*system));
+}
+
+void ParticleSystem_Clear(ParticleSystem *system) {
+    system->count = 0;
+    system->dropped = 0;
+}
+
+bool ParticleSystem_Emit(ParticleSystem *system, Vector2 position, Vector2 velocity, Color color, float life) {
+    if (system->count >= system->capacity) {
+        system->dropped++;
+        return false;
+    }
+    int i = system->count++;
+    system->posX[i] = position.x;
+    system->posY[i] = position.y;
+    system->velX[i] = velocity.x;
+    system->velY[i] = velocity.y;
+    system->life[i] = life;
+    system->color[i] = color;
+    return true;
+}
+
+// --- ATUALIZAÇÃO ---
+// Laços separados e sem desvios (as bordas viram seleções min/max), sobre ponteiros
+// restrict e com contagem múltipla de 8 (ver Lanes): cada um vira código vetorizado já
+// no -O2, que não vetoriza laços que precisariam de um resto escalar
+
+// count arredondado para o múltiplo de 8 de cima. Cabe na capacidade alocada (stride), e
+// as posições além de count só guardam restos de partículas mortas: processá-las é inócuo
+static int Lanes(int count) {
+    return (count + PARTICLE_ALIGN - 1) & ~(PARTICLE_ALIGN - 1);
+}
+
+// Um eixo: integra e devolve para dentro de [minValue, maxValue] quem passou da borda, com a
+// velocidade invertida. As comparações escritas assim viram maxps/minps (sem elas o -O2
+// gera uma cadeia de máscaras para respeitar NaN e o laço fica duas vezes mais lento)
+static void IntegrateAxis(float *restrict pos, float *restrict vel, int count, float dt, float accel,
+                          float damping, float minValue, float maxValue) {
+    int n = Lanes(count);
+    for (int i = 0; i < n; i++) {
+        float p = pos[i] + vel[i] * dt;
+        float v = (vel[i] + accel * dt) * damping;
+        float clamped = (p > minValue) ? p : minValue;
+        clamped = (clamped < maxValue) ? clamped : maxValue;
+        pos[i] = clamped;
+        vel[i] = (clamped == p) ? v : -v;
+    }
+}
+
+static void Age(float *restrict life, int count, float dt) {
+    int n = Lanes(count);
+    for (int i = 0; i < n; i++) life[i] -= dt;
+}
+
+// Remove as mortas trocando cada uma pela última viva
+static void Compact(ParticleSystem *system) {
+    int count = system->count;
+    for (int i = 0; i < count; ) {
+        if (system->life[i] > 0.0f) {
+            i++;
+            continue;
+        }
+        count--;
+        system->posX[i] = system->posX[count];
+        system->posY[i] = system->posY[count];
+        system->velX[i] = system->velX[count];
+        system->velY[i] = system->velY[count];
+        system->life[i] = system->life[count];
+        system->color[i] = system->color[count];
+    }
+    system->count = count;
+}
+
+void ParticleSystem_Update(ParticleSystem *system, float dt) {
+    const ParticleConfig *c = &system->config;
+
+    Age(system->life, system->count, dt);
+    Compact(system);
+
+    float damping = 1.0f - c->drag * dt;
+    if (damping < 0.0f) damping = 0.0f;
+    // Sem bordas, limites que nenhuma partícula alcança: o mesmo laço serve aos dois casos
+    float minX = -FLT_MAX, maxX = FLT_MAX, minY = -FLT_MAX, maxY = FLT_MAX;
+    if (c->bounded) {
+        minX = c->bounds.x;
+        maxX = c->bounds.x + c->bounds.width;
+        minY = c->bounds.y;
+        maxY = c->bounds.y + c->bounds.height;
+    }
+    IntegrateAxis(system->posX, system->velX, system->count, dt, 0.0f, damping, minX, maxX);
+    IntegrateAxis(system->posY, system->velY, system->count, dt, c->gravity, damping, minY, maxY);
+}
+
+// --- DESENHO ---
+// Um quad por partícula, todos com a mesma textura: o rlgl só acumula vértices no buffer
+// dinâmico do batch e manda tudo num draw call (o DrawCircleV gerava 36 triângulos cada)
+void ParticleSystem_Draw(const ParticleSystem *system) {
+    const ParticleConfig *c = &system->config;
+    if (system->sprite.id == 0 || system->count == 0) return;
+
+    float invFade = (c->fadeSeconds > 0.0f) ? 1.0f / c->fadeSeconds : 1.0f;
+    Rectangle source = { 0.0f, 0.0f, (float)system->sprite.width, (float)system->sprite.height };
+    bool circle = (c->shape == PARTICLE_SHAPE_CIRCLE);
+    float extent = circle ? c->size * SPRITE_SCALE : 0.0f;
+    float side = circle ? 2.0f * extent : c->size;
+
+    BeginBlendMode(BLEND_ADDITIVE);
+    for (int i = 0; i < system->count; i++) {
+        Rectangle dest = { system->posX[i] - extent, system->posY[i] - extent, side, side };
+        DrawTexturePro(system->sprite, source, dest, (Vector2){ 0.0f, 0.0f }, 0.0f, Fade(system->color[i], system->life[i] * invFade));
+    }
+    EndBlendMode();
+}
@@ -0,0 +1,59 @@
+#include <video_pack.h>
+#include <stdio.h>
+#include <string.h>
+
+bool VideoPack_Open(VideoPack *pack, const char *path) {
+    pack->header = NULL;
+    pack->index = NULL;
+
+    if (!MappedFile_Open(&pack->file, path)) {
+        printf("ERRO: Video pack %s nao encontrado.\n", path);
+        return false;
+    }
+
+    const unsigned char *data = pack->file.data;
+    size_t size = pack->file.size;
+    const VideoPackHeader *header = (const VideoPackHeader *)data;
+
+    if (size < sizeof(VideoPackHeader) || memcmp(header->magic, VIDEO_PACK_MAGIC, 4) != 0 ||
+        header->version != VIDEO_PACK_VERSION) {
+        printf("ERRO: Video pack %s invalido ou de versao incompativel.\n", path);
+        MappedFile_Close(&pack->file);
+        return false;
+    }
+
+    size_t indexEnd = sizeof(VideoPackHeader) + (size_t)header->frameCount * sizeof(VideoPackEntry);
+    if (header->frameCount == 0 || indexEnd > size) {
+        printf("ERRO: Indice do video pack %s truncado.\n", path);
+        MappedFile_Close(&pack->file);
+        return false;
+    }
+
+    // Valida todas as entradas uma vez para que a leitura por frame não precise checar limites
+    const VideoPackEntry *index = (const VideoPackEntry *)(data + sizeof(VideoPackHeader));
+    for (uint32_t i = 0; i < header->frameCount; i++) {
+        if (index[i].offset < indexEnd || index[i].offset + index[i].size > size) {
+            printf("ERRO: Frame %u do video pack %s fora dos limites.\n", i, path);
+            MappedFile_Close(&pack->file);
+            return false;
+        }
+    }
+
+    pack->header = header;
+    pack->index = index;
+    return true;
+}
+
+const unsigned char *VideoPack_GetFrame(const VideoPack *pack, int frame, int *size) {
+    if (frame < 0 || (uint32_t)frame >= pack->header->frameCount) return NULL;
+
+    const VideoPackEntry *entry = &pack->index[frame];
+    *size = (int)entry->size;
+    return pack->file.data + entry->offset;
+}
+
+void VideoPack_Close(VideoPack *pack) {
+    MappedFile_Close(&pack->file);
+    pack->header = NULL;
+    pack->index = NULL;
+}
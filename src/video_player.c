@@ -1,50 +1,525 @@
 #include "video_player.h"
+#include "video_pack.h"
+#include "jpeg_yuv.h"
+#include "atomic_ops.h"
 #include <raylib.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+
+// --- DECODIFICAÇÃO EM BACKGROUND ---
+// Um pequeno pool de workers decodifica os próximos frames (JPEG -> Image na CPU)
+// em um anel sem locks. A thread principal só envia para a GPU os frames prontos.
+#define DECODE_WORKERS 2
+#define DECODE_RING_SIZE 8
+
+typedef enum {
+    SLOT_FREE = 0,  // Slot livre, pode receber um novo frame
+    SLOT_READY      // Image decodificada, aguardando upload
+} DecodeSlotState;
+
+// Frame decodificado: RGB (Image) ou planos YCbCr (YuvImage), conforme o modo do decoder
+typedef struct {
+    Image image;
+    YuvImage yuv;
+} DecodedFrame;
+
+typedef struct {
+    DecodedFrame decoded;
+    int frame;
+    int state;      // DecodeSlotState (acesso atômico)
+} DecodeSlot;
+
+// Bytes comprimidos (JPEG) de um frame guardados em RAM; decodificar da memória é
+// bem mais barato que ler do disco a cada loop
+typedef struct {
+    unsigned char *data;    // Publicado atomicamente depois de 'size'
+    int size;
+} FrameCacheEntry;
+
+struct VideoDecoder {
+    // Origem dos frames: um .vpk mapeado em memória ou arquivos soltos (formato printf)
+    bool usePack;
+    VideoPack pack;
+    char pathFormat[256];
+    char fileType[16];  // Extensão passada ao LoadImageFromMemory (ex: ".jpg")
+    int frameCount;
+    bool planar;        // Decodifica para planos YCbCr em vez de RGB (conversão no shader)
+
+    DecodeSlot slots[DECODE_RING_SIZE];
+    int claimCursor;    // Próximo frame a ser reivindicado por um worker
+    int consumeCursor;  // Próximo frame a ser consumido pela thread principal
+    int busyWorkers;    // Workers entre a reivindicação e a publicação de um frame
+    int decodedFrames;
+    int lastLateFrame;
+    int quit;
+
+    // Salto pendente: frames [gapStart, gapEnd) nunca foram reivindicados e não serão decodificados
+    int gapStart;
+    int gapEnd;
+
+    // Cache opcional (NULL = desligado). Cada frame é decodificado por um único worker
+    // por vez, então uma entrada nunca é escrita por duas threads ao mesmo tempo.
+    FrameCacheEntry *cache;
+    size_t cacheBudget;
+    size_t cacheBytes;
+    int cacheHits;
+    int cacheMisses;
+
+    // O lock serve apenas para acordar workers ociosos; o anel em si não usa lock
+    pthread_mutex_t wakeLock;
+    pthread_cond_t wakeCond;
+    pthread_t workers[DECODE_WORKERS];
+    int workerCount;
+};
+
+// Um frame pode ser reivindicado se existir e se o slot dele já foi consumido
+static bool CanClaim(VideoDecoder *dec) {
+    int frame = ATOMIC_LOAD(&dec->claimCursor);
+    return frame < dec->frameCount && frame < ATOMIC_LOAD(&dec->consumeCursor) + DECODE_RING_SIZE;
+}
+
+static int ClaimFrame(VideoDecoder *dec) {
+    int frame = ATOMIC_LOAD(&dec->claimCursor);
+    for (;;) {
+        if (frame >= dec->frameCount) return -1;
+        if (frame >= ATOMIC_LOAD(&dec->consumeCursor) + DECODE_RING_SIZE) return -1;
+        if (ATOMIC_CAS(&dec->claimCursor, &frame, frame + 1)) return frame;
+    }
+}
+
+static void WakeWorkers(VideoDecoder *dec) {
+    pthread_mutex_lock(&dec->wakeLock);
+    pthread_cond_broadcast(&dec->wakeCond);
+    pthread_mutex_unlock(&dec->wakeLock);
+}
+
+static bool IsPackPath(const char *source) {
+    size_t len = strlen(source);
+    return len > 4 && strcmp(source + len - 4, ".vpk") == 0;
+}
+
+// Guarda os bytes do frame se ainda couberem no orçamento (o cache só cresce).
+// Com 'owned', o cache assume o buffer quando retorna true.
+static bool CacheFrame(VideoDecoder *dec, FrameCacheEntry *cache, int frame, const unsigned char *data, int size, bool owned) {
+    size_t total = ATOMIC_ADD(&dec->cacheBytes, (size_t)size);
+    if (total > dec->cacheBudget) {
+        ATOMIC_SUB(&dec->cacheBytes, (size_t)size);
+        return false;
+    }
+
+    unsigned char *copy = (unsigned char *)data;
+    if (!owned) {
+        copy = (unsigned char *)MemAlloc((unsigned int)size);
+        memcpy(copy, data, (size_t)size);
+    }
+    cache[frame].size = size;
+    ATOMIC_STORE(&cache[frame].data, copy);
+    return true;
+}
+
+// Bytes comprimidos do frame: cache, pack mapeado (sem cópia) ou disco.
+// '*owned' recebe o buffer que o chamador precisa liberar (NULL se pertence ao cache/pack).
+static const unsigned char *LoadFrameBytes(VideoDecoder *dec, FrameCacheEntry *cache, int frame, int *size, unsigned char **owned) {
+    *owned = NULL;
+    if (cache) {
+        unsigned char *cached = ATOMIC_LOAD(&cache[frame].data);
+        if (cached) {
+            ATOMIC_ADD(&dec->cacheHits, 1);
+            *size = cache[frame].size;
+            return cached;
+        }
+        ATOMIC_ADD(&dec->cacheMisses, 1);
+    }
+
+    if (dec->usePack) {
+        const unsigned char *data = VideoPack_GetFrame(&dec->pack, frame, size);
+        if (data && cache) CacheFrame(dec, cache, frame, data, *size, false);
+        return data;
+    }
+
+    char path[512];
+    snprintf(path, sizeof(path), dec->pathFormat, frame + 1);
+    unsigned char *data = LoadFileData(path, size);
+    if (data && !(cache && CacheFrame(dec, cache, frame, data, *size, true))) *owned = data;
+    return data;
+}
+
+// Decodifica um frame na thread do worker
+static DecodedFrame DecodeFrame(VideoDecoder *dec, int frame) {
+    DecodedFrame decoded = { 0 };
+    unsigned char *owned = NULL;
+    int size = 0;
+
+    const unsigned char *data = LoadFrameBytes(dec, ATOMIC_LOAD(&dec->cache), frame, &size, &owned);
+    if (!data) return decoded;
+
+    if (dec->planar) JpegYuv_Decode(data, size, &decoded.yuv);
+    else decoded.image = LoadImageFromMemory(dec->fileType, data, size);
+
+    if (owned) UnloadFileData(owned);
+    return decoded;
+}
+
+static bool IsFrameValid(const DecodedFrame *decoded) {
+    return decoded->image.data != NULL || decoded->yuv.data != NULL;
+}
+
+static void UnloadDecodedFrame(DecodedFrame *decoded) {
+    if (decoded->image.data) UnloadImage(decoded->image);
+    JpegYuv_Unload(&decoded->yuv);
+    decoded->image = (Image){0};
+}
+
+static void *DecodeWorker(void *arg) {
+    VideoDecoder *dec = (VideoDecoder *)arg;
+
+    while (!ATOMIC_LOAD(&dec->quit)) {
+        ATOMIC_ADD(&dec->busyWorkers, 1);
+        int frame = ClaimFrame(dec);
+
+        if (frame < 0) {
+            ATOMIC_ADD(&dec->busyWorkers, -1);
+
+            // Anel cheio ou vídeo no fim: dorme até a thread principal liberar um slot
+            pthread_mutex_lock(&dec->wakeLock);
+            while (!ATOMIC_LOAD(&dec->quit) && !CanClaim(dec)) {
+                pthread_cond_wait(&dec->wakeCond, &dec->wakeLock);
+            }
+            pthread_mutex_unlock(&dec->wakeLock);
+            continue;
+        }
 
-#define BUFFER_SIZE 2
-// Removida a constante MAX_LOAD_ATTEMPTS para simplificar o loop de timing,
-// focando no tempo real (vp->frameTime).
+        // Carregamento pesado do disco (I/O + decodificação), fora da thread principal
+        DecodeSlot *slot = &dec->slots[frame % DECODE_RING_SIZE];
+        slot->frame = frame;
+        slot->decoded = DecodeFrame(dec, frame);
 
-static Texture2D buffer[BUFFER_SIZE];
-static char **framePaths = NULL;
+        ATOMIC_ADD(&dec->decodedFrames, 1);
+        ATOMIC_STORE(&slot->state, SLOT_READY);
+        ATOMIC_ADD(&dec->busyWorkers, -1);
+    }
+
+    return NULL;
+}
+
+// Descarta tudo o que está no anel e recomeça a decodificação a partir de 'frame'
+static void FlushDecoder(VideoDecoder *dec, int frame) {
+    // Impede novas reivindicações e espera os workers em andamento publicarem
+    ATOMIC_EXCHANGE(&dec->claimCursor, INT_MAX);
+    while (ATOMIC_LOAD(&dec->busyWorkers) > 0) sched_yield();
+
+    for (int i = 0; i < DECODE_RING_SIZE; i++) {
+        DecodeSlot *slot = &dec->slots[i];
+        if (ATOMIC_LOAD(&slot->state) == SLOT_READY) UnloadDecodedFrame(&slot->decoded);
+        slot->decoded = (DecodedFrame){0};
+        ATOMIC_STORE(&slot->state, SLOT_FREE);
+    }
+
+    dec->lastLateFrame = -1;
+    dec->gapStart = -1;
+    ATOMIC_STORE(&dec->consumeCursor, frame);
+    ATOMIC_STORE(&dec->claimCursor, frame);
+    WakeWorkers(dec);
+}
+
+// O vídeo está atrasado: os frames ainda não reivindicados antes de 'frame' nunca serão
+// exibidos, então os workers pulam direto para ele. Os que já estão no anel são descartados.
+static void SkipDecodeTo(VideoPlayer *vp, int frame) {
+    VideoDecoder *dec = vp->decoder;
+    if (dec->gapStart >= 0) return; // Ainda há um salto pendente
+
+    int claim = ATOMIC_LOAD(&dec->claimCursor);
+    while (claim < frame) {
+        if (ATOMIC_CAS(&dec->claimCursor, &claim, frame)) {
+            dec->gapStart = claim;
+            dec->gapEnd = frame;
+            vp->stats.skippedDecodes += frame - claim;
+            WakeWorkers(dec);
+            break;
+        }
+    }
+}
+
+static void StopDecoder(VideoDecoder *dec) {
+    ATOMIC_STORE(&dec->quit, 1);
+    WakeWorkers(dec);
+    for (int i = 0; i < dec->workerCount; i++) pthread_join(dec->workers[i], NULL);
+
+    for (int i = 0; i < DECODE_RING_SIZE; i++) {
+        if (dec->slots[i].state == SLOT_READY) UnloadDecodedFrame(&dec->slots[i].decoded);
+    }
+
+    pthread_cond_destroy(&dec->wakeCond);
+    pthread_mutex_destroy(&dec->wakeLock);
+}
+
+// Embrulha um plano como Image de um canal (sem cópia) para criar/atualizar texturas
+static Image PlaneImage(const YuvImage *yuv, int plane) {
+    return (Image){ yuv->planes[plane], yuv->planeWidth[plane], yuv->planeHeight[plane], 1, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE };
+}
 
-bool VideoPlayer_Init(VideoPlayer *vp, const char *framesPathFormat, int frameCount, float fps, const char *audioPath) {
+// Cria o anel de texturas a partir do primeiro frame; os demais frames só atualizam os pixels
+static void InitTextureRing(VideoPlayer *vp, const DecodedFrame *first) {
+    for (int i = 0; i < VIDEO_TEXTURE_RING; i++) {
+        if (vp->planar) {
+            vp->textures[i] = LoadTextureFromImage(PlaneImage(&first->yuv, 0));
+            for (int c = 0; c < 2; c++) {
+                // O croma tem resolução menor: a filtragem bilinear da GPU faz o upsampling
+                vp->chroma[i][c] = LoadTextureFromImage(PlaneImage(&first->yuv, c + 1));
+                SetTextureFilter(vp->chroma[i][c], TEXTURE_FILTER_BILINEAR);
+            }
+        } else {
+            vp->textures[i] = LoadTextureFromImage(first->image);
+        }
+    }
+    vp->textureIndex = 0;
+    vp->frameWidth = vp->planar ? first->yuv.width : first->image.width;
+    vp->frameHeight = vp->planar ? first->yuv.height : first->image.height;
+}
+
+// Planos Y/Cb/Cr direto nas texturas de um canal: sem conversão de cor na CPU
+static bool UploadPlanes(VideoPlayer *vp, const YuvImage *yuv, int slot) {
+    Texture2D planes[3] = { vp->textures[slot], vp->chroma[slot][0], vp->chroma[slot][1] };
+
+    for (int i = 0; i < 3; i++) {
+        if (yuv->planeWidth[i] != planes[i].width || yuv->planeHeight[i] != planes[i].height) {
+            printf("AVISO: Frame com layout YUV diferente do primeiro, mantendo o anterior.\n");
+            return false;
+        }
+    }
+    for (int i = 0; i < 3; i++) {
+        UpdateTexture(planes[i], yuv->planes[i]);
+        vp->stats.uploadedBytes += (size_t)yuv->planeWidth[i] * (size_t)yuv->planeHeight[i];
+    }
+    return true;
+}
+
+// Envia o frame decodificado para a GPU (única parte que precisa da thread principal).
+// O frame vai para o próximo slot do anel, evitando escrever na textura ainda em uso pelo driver.
+static void UploadFrame(VideoPlayer *vp, const DecodedFrame *decoded, int frame) {
+    if (vp->textureFrame >= 0 && frame > vp->textureFrame + 1) {
+        vp->stats.droppedFrames += frame - vp->textureFrame - 1;
+    }
+
+    int next = (vp->textureIndex + 1) % VIDEO_TEXTURE_RING;
+    Texture2D tex = vp->textures[next];
+    if (tex.id == 0) return;
+
+    if (vp->planar) {
+        if (!UploadPlanes(vp, &decoded->yuv, next)) return;
+    } else {
+        Image image = decoded->image;
+
+        // Frames fora do padrão (tamanho/formato) são convertidos para caber na textura existente
+        if (image.width != tex.width || image.height != tex.height || image.format != tex.format) {
+            Image copy = ImageCopy(image);
+            ImageFormat(&copy, tex.format);
+            ImageResize(&copy, tex.width, tex.height);
+            UpdateTexture(tex, copy.data);
+            UnloadImage(copy);
+        } else {
+            UpdateTexture(tex, image.data);
+        }
+        vp->stats.uploadedBytes += (size_t)GetPixelDataSize(tex.width, tex.height, tex.format);
+    }
+
+    vp->textureIndex = next;
+    vp->textureFrame = frame;
+    vp->stats.uploadedFrames++;
+}
+
+// Consome do anel os frames até o frame atual; nunca bloqueia esperando um worker
+static void PresentFrame(VideoPlayer *vp) {
+    VideoDecoder *dec = vp->decoder;
+    int target = vp->currentFrame;
+
+    // Frame mais novo já decodificado antes do alvo: exibido se o alvo ainda não estiver pronto
+    DecodedFrame fallback = { 0 };
+    int fallbackFrame = -1;
+
+    while (vp->textureFrame != target) {
+        int frame = ATOMIC_LOAD(&dec->consumeCursor);
+
+        // Chegou ao trecho pulado: os slots desses frames nunca foram usados
+        if (frame == dec->gapStart) {
+            dec->gapStart = -1;
+            ATOMIC_STORE(&dec->consumeCursor, dec->gapEnd);
+            WakeWorkers(dec);
+            continue;
+        }
+        if (frame > target || frame >= vp->frameCount) break;
+
+        DecodeSlot *slot = &dec->slots[frame % DECODE_RING_SIZE];
+        if (ATOMIC_LOAD(&slot->state) != SLOT_READY) {
+            // O frame deveria estar na tela e ainda não foi decodificado: mantém o último bom
+            if (dec->lastLateFrame != target) {
+                dec->lastLateFrame = target;
+                vp->stats.lateFrames++;
+            }
+            break;
+        }
+
+        DecodedFrame decoded = slot->decoded;
+        slot->decoded = (DecodedFrame){0};
+        ATOMIC_STORE(&slot->state, SLOT_FREE);
+        ATOMIC_STORE(&dec->consumeCursor, frame + 1);
+        WakeWorkers(dec);
+
+        if (!IsFrameValid(&decoded)) {
+            // Disco lento/arquivo corrompido: o frame pode travar no último bom.
+            printf("AVISO: Falha na leitura do disco para o frame %d. Stuttering esperado.\n", frame);
+        } else if (frame == target) {
+            UploadFrame(vp, &decoded, frame);
+        } else {
+            // Atrasado: guarda só o mais recente, os anteriores nunca vão aparecer
+            UnloadDecodedFrame(&fallback);
+            fallback = decoded;
+            fallbackFrame = frame;
+            continue;
+        }
+        UnloadDecodedFrame(&decoded);
+    }
+
+    if (IsFrameValid(&fallback)) {
+        if (vp->textureFrame != target) UploadFrame(vp, &fallback, fallbackFrame);
+        UnloadDecodedFrame(&fallback);
+    }
+
+    vp->stats.decodedFrames = ATOMIC_LOAD(&dec->decodedFrames);
+    vp->stats.cacheHits = ATOMIC_LOAD(&dec->cacheHits);
+    vp->stats.cacheMisses = ATOMIC_LOAD(&dec->cacheMisses);
+    vp->stats.cacheBytes = ATOMIC_LOAD(&dec->cacheBytes);
+}
+
+// --- CONVERSÃO YUV NA GPU ---
+// Usa o vertex shader padrão do raylib; texture0 = Y, texture1 = Cb, texture2 = Cr.
+// JPEG/JFIF usa YCbCr BT.601 de faixa completa.
+static const char *yuvFragmentShader =
+    "#version 330\n"
+    "in vec2 fragTexCoord;\n"
+    "in vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform sampler2D texture1;\n"
+    "uniform sampler2D texture2;\n"
+    "uniform vec4 colDiffuse;\n"
+    "out vec4 finalColor;\n"
+    "void main() {\n"
+    "    float y = texture(texture0, fragTexCoord).r;\n"
+    "    float cb = texture(texture1, fragTexCoord).r - 0.5;\n"
+    "    float cr = texture(texture2, fragTexCoord).r - 0.5;\n"
+    "    vec3 rgb = vec3(y + 1.402*cr, y - 0.344136*cb - 0.714136*cr, y + 1.772*cb);\n"
+    "    finalColor = vec4(clamp(rgb, 0.0, 1.0), 1.0)*colDiffuse*fragColor;\n"
+    "}\n";
+
+static void InitPlanarPath(VideoPlayer *vp, VideoDecoder *dec) {
+    unsigned char *owned = NULL;
+    int size = 0;
+    const unsigned char *data = LoadFrameBytes(dec, NULL, 0, &size, &owned);
+    bool supported = data && JpegYuv_IsSupported(data, size);
+    if (owned) UnloadFileData(owned);
+    if (!supported) return;
+
+    Shader shader = LoadShaderFromMemory(NULL, yuvFragmentShader);
+    int cbLoc = GetShaderLocation(shader, "texture1");
+    int crLoc = GetShaderLocation(shader, "texture2");
+    if (cbLoc < 0 || crLoc < 0) {
+        // Falhou ao compilar (o raylib devolve o shader padrão): segue pelo caminho RGB
+        UnloadShader(shader);
+        return;
+    }
+
+    vp->yuvShader = shader;
+    vp->chromaLocs[0] = cbLoc;
+    vp->chromaLocs[1] = crLoc;
+    vp->planar = true;
+    dec->planar = true;
+}
+
+bool VideoPlayer_Init(VideoPlayer *vp, const char *framesSource, int frameCount, float fps, const char *audioPath) {
     vp->frameCount = frameCount;
     vp->currentFrame = 0;
     vp->frameTime = 1.0f / fps;
     vp->timer = 0.0f;
     vp->audioPlayed = false;
+    vp->syncToAudio = false;
+    vp->rate = 1.0f;
+    vp->music = (Music){0};
+    for (int i = 0; i < VIDEO_TEXTURE_RING; i++) {
+        vp->textures[i] = (Texture2D){0};
+        vp->chroma[i][0] = vp->chroma[i][1] = (Texture2D){0};
+    }
+    vp->textureIndex = 0;
+    vp->textureFrame = -1;
+    vp->frameWidth = vp->frameHeight = 0;
+    vp->planar = false;
+    vp->yuvShader = (Shader){0};
+    vp->stats = (VideoPlayerStats){0};
+
+    VideoDecoder *dec = (VideoDecoder *)calloc(1, sizeof(VideoDecoder));
+    vp->decoder = dec;
+    dec->lastLateFrame = -1;
+    dec->gapStart = -1;
+
+    // Origem dos frames: o pack define a contagem e o FPS do vídeo
+    if (IsPackPath(framesSource)) {
+        if (!VideoPack_Open(&dec->pack, framesSource)) {
+            free(dec);
+            vp->decoder = NULL;
+            return false;
+        }
+        dec->usePack = true;
+        vp->frameCount = (int)dec->pack.header->frameCount;
+        if (dec->pack.header->fps > 0.0f) vp->frameTime = 1.0f / dec->pack.header->fps;
+        snprintf(dec->fileType, sizeof(dec->fileType), ".jpg");
+    } else {
+        snprintf(dec->pathFormat, sizeof(dec->pathFormat), "%s", framesSource);
+        snprintf(dec->fileType, sizeof(dec->fileType), "%s", GetFileExtension(framesSource));
+    }
+    dec->frameCount = vp->frameCount;
+
+    // Decide o caminho antes dos workers começarem: planar se o JPEG permitir e o shader compilar
+    if (vp->frameCount > 0) InitPlanarPath(vp, dec);
 
-    // Inicialização do Array de Caminhos
-    framePaths = (char **)malloc(sizeof(char *) * frameCount);
-    for (int i = 0; i < frameCount; i++) {
-        framePaths[i] = (char *)malloc(256);
-        sprintf(framePaths[i], framesPathFormat, i + 1);
+    // Inicia os workers de decodificação
+    pthread_mutex_init(&dec->wakeLock, NULL);
+    pthread_cond_init(&dec->wakeCond, NULL);
+    for (int i = 0; i < DECODE_WORKERS; i++) {
+        if (pthread_create(&dec->workers[dec->workerCount], NULL, DecodeWorker, dec) == 0) dec->workerCount++;
     }
 
-    // Pré-carregamento do Buffer Inicial
-    for (int i = 0; i < BUFFER_SIZE && i < frameCount; i++) {
-        // Inicializa o slot como vazio
-        buffer[i] = (Texture2D){0};
+    if (dec->workerCount == 0) {
+        printf("Erro ao criar threads de decodificacao do video\n");
+        VideoPlayer_Unload(vp);
+        return false;
+    }
 
-        Image img = LoadImage(framePaths[i]);
-        if (!img.data) {
-            printf("Erro ao carregar frame inicial %s\n", framePaths[i]);
+    // Espera o primeiro frame para que o vídeo comece já com imagem
+    if (vp->frameCount > 0) {
+        DecodeSlot *first = &dec->slots[0];
+        while (ATOMIC_LOAD(&first->state) != SLOT_READY) sched_yield();
+
+        if (!IsFrameValid(&first->decoded)) {
+            printf("Erro ao carregar frame inicial de %s\n", framesSource);
             // Limpa o que foi alocado antes de falhar
             VideoPlayer_Unload(vp);
             return false;
         }
-        buffer[i] = LoadTextureFromImage(img);
-        UnloadImage(img);
+        InitTextureRing(vp, &first->decoded);
+        PresentFrame(vp);
     }
 
     // Configuração do Áudio
-    vp->music = (Music){0};
     if (audioPath) {
         vp->music = LoadMusicStream(audioPath);
+        // O áudio serve de relógio: não pode voltar ao início no meio do vídeo
+        vp->music.looping = false;
+        vp->syncToAudio = (vp->music.ctxData != NULL);
     }
 
     return true;
@@ -58,7 +533,7 @@ void VideoPlayer_Update(VideoPlayer *vp, float delta) {
         return;
     }
 
-    vp->timer += delta;
+    vp->timer += delta * vp->rate;
 
     // Controle de Áudio
     if (!vp->audioPlayed && vp->music.ctxData != NULL) {
@@ -74,84 +549,120 @@ void VideoPlayer_Update(VideoPlayer *vp, float delta) {
         return;
     }
 
-    // Lógica de Troca de Frame e Buffering
+    // Lógica de Troca de Frame: descobre qual frame deveria estar na tela agora
+    int target = vp->currentFrame;
     while (vp->timer >= vp->frameTime) {
         vp->timer -= vp->frameTime;
+        target++;
+    }
 
-        int oldIndex = vp->currentFrame % BUFFER_SIZE;
-        vp->currentFrame++;
-
-        // Se o novo frame for o último frame do vídeo, paramos de carregar no buffer
-        if (vp->currentFrame >= vp->frameCount) {
-            if (vp->audioPlayed) StopMusicStream(vp->music);
-            return;
+    // O áudio é o relógio mestre: o delta só move o vídeo suavemente entre correções.
+    // Ressincroniza quando a diferença passa de um frame (ruído do relógio não causa descarte).
+    if (vp->syncToAudio && vp->audioPlayed && IsMusicStreamPlaying(vp->music)) {
+        float audioTime = GetMusicTimePlayed(vp->music);
+        float videoTime = target * vp->frameTime + vp->timer;
+        if (fabsf(videoTime - audioTime) > vp->frameTime) {
+            int audioFrame = (int)(audioTime / vp->frameTime);
+            // O vídeo nunca volta para trás; se estiver adiantado, segura o frame atual
+            target = (audioFrame > vp->currentFrame) ? audioFrame : vp->currentFrame;
+            vp->timer = audioTime - target * vp->frameTime;
+            if (vp->timer < 0.0f) vp->timer = 0.0f;
         }
+    }
 
-        // --- LÓGICA DE CARREGAMENTO (Background Loading) ---
-        int nextFrameIndex = vp->currentFrame + BUFFER_SIZE - 1;
-
-        if (nextFrameIndex < vp->frameCount) {
-
-            // 1. Carregamento pesado do disco (I/O)
-            Image img = LoadImage(framePaths[nextFrameIndex]);
+    // Se o novo frame passar do último frame do vídeo, paramos
+    if (target >= vp->frameCount) {
+        vp->currentFrame = vp->frameCount;
+        if (vp->audioPlayed) StopMusicStream(vp->music);
+        return;
+    }
 
-            if (img.data) {
-                // 2. Descarrega o slot antigo da VRAM
-                // AQUI: Garantimos que o ID é válido antes de descarregar
-                if (buffer[oldIndex].id != 0) UnloadTexture(buffer[oldIndex]);
+    bool advanced = (target != vp->currentFrame);
+    if (target > vp->currentFrame + 1) SkipDecodeTo(vp, target);
+    vp->currentFrame = target;
 
-                // 3. Carrega a nova textura para VRAM
-                buffer[oldIndex] = LoadTextureFromImage(img);
+    // Apenas o upload acontece aqui; a decodificação já foi feita pelos workers
+    PresentFrame(vp);
+    if (advanced && vp->textureFrame != vp->currentFrame) vp->stats.repeatedFrames++;
 
-                UnloadImage(img);
-            } else {
-                // Se o LoadImage falhar (disco lento/arquivo corrompido),
-                // o slot de VRAM antigo fica sem ser atualizado.
-                // O frame pode travar no último bom.
-                // Log de erro:
-                printf("AVISO: Falha na leitura do disco para o frame %d. Stuttering esperado.\n", nextFrameIndex);
-            }
-        }
+    if (vp->audioPlayed && IsMusicStreamPlaying(vp->music) && vp->textureFrame >= 0) {
+        vp->stats.drift = vp->textureFrame * vp->frameTime - GetMusicTimePlayed(vp->music);
+        if (fabsf(vp->stats.drift) > vp->stats.maxDrift) vp->stats.maxDrift = fabsf(vp->stats.drift);
     }
 }
+
 void VideoPlayer_Draw(VideoPlayer *vp, int x, int y, int width, int height) {
     if (VideoPlayer_IsFinished(vp)) return;
 
-    int idx = vp->currentFrame % BUFFER_SIZE;
-    Texture2D tex = buffer[idx];
+    Texture2D tex = vp->textures[vp->textureIndex];
 
     // Garante que a textura seja válida
     if (tex.id == 0) return;
 
-    float scaleX = (float)width / tex.width;
-    float scaleY = (float)height / tex.height;
+    // As texturas planares são alinhadas ao MCU; a área visível é só o tamanho real do frame
+    float scaleX = (float)width / vp->frameWidth;
+    float scaleY = (float)height / vp->frameHeight;
     float scale = (scaleX < scaleY) ? scaleX : scaleY;
 
-    int drawWidth = tex.width * scale;
-    int drawHeight = tex.height * scale;
+    int drawWidth = vp->frameWidth * scale;
+    int drawHeight = vp->frameHeight * scale;
     int offsetX = (width - drawWidth) / 2;
     int offsetY = (height - drawHeight) / 2;
 
+    if (vp->planar) {
+        BeginShaderMode(vp->yuvShader);
+        SetShaderValueTexture(vp->yuvShader, vp->chromaLocs[0], vp->chroma[vp->textureIndex][0]);
+        SetShaderValueTexture(vp->yuvShader, vp->chromaLocs[1], vp->chroma[vp->textureIndex][1]);
+    }
+
     DrawTexturePro(tex,
-                   (Rectangle){0, 0, (float)tex.width, (float)tex.height},
+                   (Rectangle){0, 0, (float)vp->frameWidth, (float)vp->frameHeight},
                    (Rectangle){(float)(x + offsetX), (float)(y + offsetY), (float)drawWidth, (float)drawHeight},
                    (Vector2){0, 0}, 0.0f, WHITE);
+
+    if (vp->planar) EndShaderMode();
 }
 
 void VideoPlayer_Unload(VideoPlayer *vp) {
-    for (int i = 0; i < BUFFER_SIZE; i++) {
-        if (buffer[i].id) UnloadTexture(buffer[i]);
-        buffer[i] = (Texture2D){0};
+    VideoDecoder *dec = vp->decoder;
+
+    if (dec) {
+        StopDecoder(dec);
+
+        printf("VideoPlayer: %d frames decodificados, %d enviados (%.1f MB, %s), %d atrasados\n",
+               vp->stats.decodedFrames, vp->stats.uploadedFrames, vp->stats.uploadedBytes / (1024.0f * 1024.0f),
+               vp->planar ? "YUV planar" : "RGB", vp->stats.lateFrames);
+        printf("VideoPlayer: %d descartados (%d sem decodificar), %d repetidos, drift maximo %.1f ms\n",
+               vp->stats.droppedFrames, vp->stats.skippedDecodes, vp->stats.repeatedFrames, vp->stats.maxDrift * 1000.0f);
+
+        if (dec->cache) {
+            printf("VideoPlayer: cache %d acertos, %d falhas, %.1f MB residentes\n",
+                   vp->stats.cacheHits, vp->stats.cacheMisses, vp->stats.cacheBytes / (1024.0f * 1024.0f));
+            for (int i = 0; i < dec->frameCount; i++) {
+                if (dec->cache[i].data) UnloadFileData(dec->cache[i].data);
+            }
+            free(dec->cache);
+        }
+
+        if (dec->usePack) VideoPack_Close(&dec->pack);
+
+        free(dec);
+        vp->decoder = NULL;
     }
 
-    // Limpeza dos caminhos alocados
-    if (framePaths) {
-        for (int i = 0; i < vp->frameCount; i++) {
-            if (framePaths[i]) free(framePaths[i]);
+    for (int i = 0; i < VIDEO_TEXTURE_RING; i++) {
+        if (vp->textures[i].id) UnloadTexture(vp->textures[i]);
+        vp->textures[i] = (Texture2D){0};
+        for (int c = 0; c < 2; c++) {
+            if (vp->chroma[i][c].id) UnloadTexture(vp->chroma[i][c]);
+            vp->chroma[i][c] = (Texture2D){0};
         }
-        free(framePaths);
-        framePaths = NULL;
     }
+    if (vp->planar) UnloadShader(vp->yuvShader);
+    vp->yuvShader = (Shader){0};
+    vp->planar = false;
+    vp->textureIndex = 0;
+    vp->textureFrame = -1;
 
     if (vp->audioPlayed) StopMusicStream(vp->music);
     UnloadMusicStream(vp->music);
@@ -163,11 +674,81 @@ bool VideoPlayer_IsFinished(VideoPlayer *vp) {
     return vp->currentFrame >= vp->frameCount;
 }
 
+// Reposiciona a decodificação. Todo frame é independente (JPEG) e acessado direto pelo
+// índice do pack ou pelo número do arquivo, então o anel se refaz com no máximo
+// DECODE_RING_SIZE decodificações, sem reler o vídeo desde o início.
+static void SeekFrame(VideoPlayer *vp, int frame) {
+    vp->currentFrame = frame;
+
+    // Mantém o último frame na tela até o novo ficar pronto
+    if (vp->decoder) {
+        FlushDecoder(vp->decoder, frame);
+        vp->textureFrame = -1;
+        PresentFrame(vp);
+    }
+}
+
 void VideoPlayer_Reset(VideoPlayer *vp) {
-    vp->currentFrame = 0;
     vp->timer = 0.0f;
     if (vp->audioPlayed) {
         StopMusicStream(vp->music);
         vp->audioPlayed = false;
     }
-}
\ No newline at end of file
+    SeekFrame(vp, 0);
+}
+
+void VideoPlayer_Seek(VideoPlayer *vp, float seconds) {
+    if (vp->frameCount <= 0 || vp->frameTime <= 0.0f) return;
+
+    float duration = vp->frameCount * vp->frameTime;
+    if (seconds < 0.0f) seconds = 0.0f;
+    if (seconds > duration - vp->frameTime) seconds = duration - vp->frameTime;
+
+    int frame = (int)(seconds / vp->frameTime);
+    vp->timer = seconds - frame * vp->frameTime;
+    vp->stats.seeks++;
+    SeekFrame(vp, frame);
+
+    // O áudio acompanha; se já tinha parado (fim do vídeo), volta a tocar
+    if (vp->music.ctxData != NULL) {
+        if (seconds < GetMusicTimeLength(vp->music)) {
+            if (!IsMusicStreamPlaying(vp->music)) PlayMusicStream(vp->music);
+            SeekMusicStream(vp->music, seconds);
+            vp->audioPlayed = true;
+        } else {
+            // Depois do fim do áudio: fica em silêncio (e o Update não o reinicia do zero)
+            StopMusicStream(vp->music);
+            vp->audioPlayed = true;
+        }
+    }
+}
+
+float VideoPlayer_GetTime(VideoPlayer *vp) {
+    return vp->currentFrame * vp->frameTime + vp->timer;
+}
+
+void VideoPlayer_SetRate(VideoPlayer *vp, float rate) {
+    if (rate < VIDEO_RATE_MIN) rate = VIDEO_RATE_MIN;
+    if (rate > VIDEO_RATE_MAX) rate = VIDEO_RATE_MAX;
+    vp->rate = rate;
+
+    // O pitch do raylib reamostra o stream: o áudio (e o relógio dele) anda na mesma taxa
+    if (vp->music.ctxData != NULL) SetMusicPitch(vp->music, rate);
+}
+
+bool VideoPlayer_EnableCache(VideoPlayer *vp, size_t budgetBytes) {
+    VideoDecoder *dec = vp->decoder;
+    if (!dec || dec->cache || dec->frameCount <= 0) return false;
+
+    FrameCacheEntry *cache = (FrameCacheEntry *)calloc((size_t)dec->frameCount, sizeof(FrameCacheEntry));
+    if (!cache) return false;
+
+    // Os workers já estão rodando: o orçamento precisa estar visível antes do ponteiro
+    dec->cacheBudget = budgetBytes;
+    ATOMIC_STORE(&dec->cache, cache);
+    return true;
+}
+
+void VideoPlayer_SetAudioSync(VideoPlayer *vp, bool enabled) {
+    vp->syncToAudio = enabled && vp->music.ctxData != NULL;
+}
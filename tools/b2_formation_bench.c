@@ -0,0 +1,205 @@
+// b2_formation_bench: marcha da formação do Byte Space, antiga (array de structs, três
+// passadas) x estrutura de arrays (b2_formation)
+//
+// Uso:
+//   b2_formation_bench [ticks]
+//
+// Para 55..5000 inimigos (uma formação como a do jogo, com um terço já morto), mede o custo
+// por tick de:
+//   - antigo: o laço do UpdateEnemies de antes, sobre structs de ~60 bytes (posição, rect,
+//     cor, timers): uma passada para os timers e a borda, uma para o passo de lado e uma
+//     para a descida
+//   - SoA: TickB2FormationTimers + MeasureB2Formation + ShiftB2Formation em x (e em y na
+//     descida), sobre arrays de float com a máscara de vivos
+// e confere que os dois chegam às mesmas posições. Não depende da raylib.
+
+#include "b2_formation.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOGDI
+#define NOUSER
+#include <windows.h>
+static double Seconds(void) {
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+}
+#else
+#include <time.h>
+static double Seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+#endif
+
+// Medidas do jogo (b2_enemy.h / b2_enemy.c)
+#define ENEMY_SIZE 40.0f
+#define ENEMY_SPACING 55.0f         // ENEMY_SIZE + ENEMY_PADDING
+#define HALF_WIDTH 25.0f            // ENEMY_BOUNDS_HALF_WIDTH
+#define DROP_AMOUNT 20.0f
+#define BENCH_DT (1.0f / 120.0f)    // B2_TICK_DT
+#define BENCH_SPEED 4000.0f         // Rápido, para a formação bater nas bordas com frequência
+#define BENCH_MARGIN 2.0f
+
+static const int enemyCounts[] = { 55, 200, 1000, 5000 };
+
+// --- VERSÃO ANTIGA (o Enemy e o laço do UpdateEnemies de antes do SoA) ---
+typedef struct { float x, y; } Vec2;
+typedef struct { float x, y, width, height; } Rect;
+typedef struct { unsigned char r, g, b, a; } Rgba;
+
+typedef struct {
+    Vec2 position;
+    Rect rect;
+    int type;
+    int health;
+    bool active;
+    float hitTimer;
+    Rgba neonColor;
+    bool isExploding;
+    float explosionTimer;
+} LegacyEnemy;
+
+typedef struct {
+    float speed;
+    int direction;
+} March;
+
+static void LegacyStep(LegacyEnemy *enemies, int count, March *march, float width) {
+    float moveAmount = march->speed * march->direction * BENCH_DT;
+    float minX = width, maxX = 0.0f;
+
+    for (int i = 0; i < count; i++) {
+        LegacyEnemy *enemy = &enemies[i];
+        if (enemy->hitTimer > 0.0f) enemy->hitTimer -= BENCH_DT;
+        if (enemy->isExploding) {
+            enemy->explosionTimer -= BENCH_DT;
+            if (enemy->explosionTimer <= 0.0f) enemy->isExploding = false;
+        }
+        if (!enemy->active && !enemy->isExploding) continue;
+        if (enemy->active) {
+            minX = fminf(minX, enemy->rect.x);
+            maxX = fmaxf(maxX, enemy->rect.x + enemy->rect.width);
+        }
+    }
+
+    bool shouldDrop = (march->direction == 1) ? (maxX >= width - BENCH_MARGIN) : (minX <= BENCH_MARGIN);
+
+    for (int i = 0; i < count; i++) {
+        LegacyEnemy *enemy = &enemies[i];
+        if (!enemy->active) continue;
+        enemy->position.x += moveAmount;
+        enemy->rect.x = enemy->position.x - enemy->rect.width / 2.0f;
+    }
+
+    if (shouldDrop) {
+        march->direction *= -1;
+        for (int i = 0; i < count; i++) {
+            LegacyEnemy *enemy = &enemies[i];
+            if (!enemy->active) continue;
+            enemy->position.y += DROP_AMOUNT;
+            enemy->rect.y = enemy->position.y - enemy->rect.height / 2.0f;
+        }
+    }
+}
+
+// --- SOA ---
+typedef struct {
+    float *x, *y, *live, *hitTimer;
+} Formation;
+
+static void SoaStep(Formation *f, int capacity, March *march, float width) {
+    float moveAmount = march->speed * march->direction * BENCH_DT;
+
+    TickB2FormationTimers(f->hitTimer, capacity, BENCH_DT);
+    float minX, maxX;
+    MeasureB2Formation(f->x, f->live, capacity, &minX, &maxX);
+    minX -= HALF_WIDTH;
+    maxX += HALF_WIDTH;
+
+    bool shouldDrop = (march->direction == 1) ? (maxX >= width - BENCH_MARGIN) : (minX <= BENCH_MARGIN);
+
+    ShiftB2Formation(f->x, f->live, capacity, moveAmount);
+    if (shouldDrop) {
+        march->direction *= -1;
+        ShiftB2Formation(f->y, f->live, capacity, DROP_AMOUNT);
+    }
+}
+
+static bool RunCase(int count, int ticks) {
+    int cols = 11;
+    while (cols * cols < count * 2) cols++;
+    float width = cols * ENEMY_SPACING + 400.0f;
+    int capacity = B2_FORMATION_ROUND(count);
+
+    LegacyEnemy *legacy = (LegacyEnemy *)calloc((size_t)count, sizeof(LegacyEnemy));
+    float *block = (float *)calloc((size_t)capacity * 4, sizeof(float));
+    if (!legacy || !block) {
+        printf("Sem memoria para %d inimigos.\n", count);
+        free(legacy); free(block);
+        return false;
+    }
+    Formation soa = { block, block + capacity, block + capacity * 2, block + capacity * 3 };
+
+    // Mesma formação nos dois, com um de cada três já morto
+    for (int i = 0; i < count; i++) {
+        float x = 200.0f + (i % cols + 0.5f) * ENEMY_SPACING;
+        float y = (i / cols + 0.5f) * ENEMY_SPACING;
+        bool active = (i % 3) != 0;
+        legacy[i] = (LegacyEnemy){
+            .position = { x, y }, .rect = { x - HALF_WIDTH, y - HALF_WIDTH, 2.0f * HALF_WIDTH, 2.0f * HALF_WIDTH },
+            .type = 1, .health = 1, .active = active, .neonColor = { 0, 191, 255, 255 }
+        };
+        soa.x[i] = x;
+        soa.y[i] = y;
+        soa.live[i] = active ? 1.0f : 0.0f;
+    }
+
+    March legacyMarch = { BENCH_SPEED, 1 }, soaMarch = { BENCH_SPEED, 1 };
+    double start = Seconds();
+    for (int t = 0; t < ticks; t++) LegacyStep(legacy, count, &legacyMarch, width);
+    double legacyTime = Seconds() - start;
+
+    start = Seconds();
+    for (int t = 0; t < ticks; t++) SoaStep(&soa, capacity, &soaMarch, width);
+    double soaTime = Seconds() - start;
+
+    // Conferência: vivos nas mesmas posições (o arredondamento do rect antigo pode mudar
+    // o tick de uma virada, então a tolerância cobre um passo)
+    int mismatches = 0;
+    for (int i = 0; i < count; i++) {
+        if (!legacy[i].active) continue;
+        if (fabsf(legacy[i].position.x - soa.x[i]) > BENCH_SPEED * BENCH_DT * 2.0f ||
+            fabsf(legacy[i].position.y - soa.y[i]) > DROP_AMOUNT * 0.5f) mismatches++;
+    }
+
+    double legacyUs = legacyTime * 1e6 / ticks;
+    double soaUs = soaTime * 1e6 / ticks;
+    printf("%8d %14.2f %12.2f %8.1fx%s\n", count, legacyUs, soaUs, soaUs > 0.0 ? legacyUs / soaUs : 0.0,
+           mismatches ? "  DIVERGENTE" : "");
+
+    free(legacy);
+    free(block);
+    return mismatches == 0;
+}
+
+int main(int argc, char **argv) {
+    int ticks = (argc > 1) ? atoi(argv[1]) : 20000;
+    if (ticks < 1) ticks = 20000;
+
+    printf("inimigos  antigo us/tick   SoA us/tick    ganho\n");
+    bool ok = true;
+    for (size_t e = 0; e < sizeof(enemyCounts) / sizeof(enemyCounts[0]); e++) {
+        if (!RunCase(enemyCounts[e], ticks)) ok = false;
+    }
+    if (!ok) printf("FALHA: as duas versoes levaram a formacao a posicoes diferentes.\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,176 @@
+// b2_grid_bench: colisão tiro x inimigo do Byte Space, força bruta x grid uniforme (b2_grid)
+//
+// Uso:
+//   b2_grid_bench [semente]
+//
+// Para cada combinação de 20..5000 tiros e 55..2000 inimigos (numa formação como a do
+// jogo, que anda de lado a cada frame), mede o custo por frame de:
+//   - força bruta: cada tiro contra todos os inimigos (o antigo CheckBulletEnemyCollision)
+//   - grid: atualização incremental das células + consulta + teste exato nos candidatos
+//   - jogo: o que o CheckBulletEnemyCollision faz, força bruta abaixo de GRID_MIN_PAIRS
+//     pares tiro x inimigo e grid daí para cima
+// e confere que todos escolhem o mesmo inimigo para cada tiro. Não depende da raylib.
+
+#include "b2_grid.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOGDI
+#define NOUSER
+#include <windows.h>
+static double Seconds(void) {
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+}
+#else
+#include <time.h>
+static double Seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+#endif
+
+// Medidas do jogo (b2_enemy.h / b2_bullet.c)
+#define ENEMY_RADIUS 20.0f
+#define ENEMY_SPACING 55.0f         // ENEMY_SIZE + ENEMY_PADDING
+#define BULLET_RADIUS 8.0f
+#define CELL_SIZE 64.0f             // ENEMY_GRID_CELL_SIZE
+#define GRID_MIN_PAIRS 2048         // ENEMY_GRID_MIN_PAIRS
+#define FORMATION_SWAY 40.0f        // Quanto a formação anda para cada lado
+
+static const int bulletCounts[] = { 20, 100, 500, 1000, 5000 };
+static const int enemyCounts[] = { 55, 200, 500, 1000, 2000 };
+
+typedef struct { float x, y; } Point;
+
+static bool CirclesTouch(Point a, float ra, Point b, float rb) {
+    float dx = a.x - b.x, dy = a.y - b.y, r = ra + rb;
+    return dx * dx + dy * dy <= r * r;
+}
+
+static float RandomRange(float minValue, float maxValue) {
+    return minValue + (float)rand() / (float)RAND_MAX * (maxValue - minValue);
+}
+
+// --- FORÇA BRUTA ---
+static int BruteFirstHit(const Point *enemies, int enemyCount, Point bullet) {
+    for (int j = 0; j < enemyCount; j++) {
+        if (CirclesTouch(bullet, BULLET_RADIUS, enemies[j], ENEMY_RADIUS)) return j;
+    }
+    return -1;
+}
+
+// --- GRID (o mesmo laço do CheckBulletEnemyCollision) ---
+static int GridFirstHit(const B2Grid *grid, const Point *enemies, Point bullet, int *candidates, int maxCandidates) {
+    int count = QueryB2Grid(grid, (Vector2){ bullet.x, bullet.y }, BULLET_RADIUS, candidates, maxCandidates);
+    int hit = -1;
+    for (int c = 0; c < count; c++) {
+        int j = candidates[c];
+        if (hit >= 0 && j > hit) continue;
+        if (CirclesTouch(bullet, BULLET_RADIUS, enemies[j], ENEMY_RADIUS)) hit = j;
+    }
+    return hit;
+}
+
+static bool RunCase(int bulletCount, int enemyCount) {
+    // Formação em grade, com espaço embaixo (onde fica o jogador) para os tiros
+    int cols = 11;
+    while (cols * cols < enemyCount * 2) cols++;
+    int rows = (enemyCount + cols - 1) / cols;
+    float width = cols * ENEMY_SPACING + 2.0f * FORMATION_SWAY;
+    float height = rows * ENEMY_SPACING + 300.0f;
+
+    Point *home = (Point *)malloc((size_t)enemyCount * sizeof(Point));
+    Point *enemies = (Point *)malloc((size_t)enemyCount * sizeof(Point));
+    Point *bullets = (Point *)malloc((size_t)bulletCount * sizeof(Point));
+    int *candidates = (int *)malloc((size_t)enemyCount * sizeof(int));
+    B2Grid grid;
+    Rectangle area = { 0.0f, 0.0f, width, height };
+    if (!home || !enemies || !bullets || !candidates || !InitB2Grid(&grid, area, CELL_SIZE, enemyCount, ENEMY_RADIUS)) {
+        printf("Sem memoria para %d tiros x %d inimigos.\n", bulletCount, enemyCount);
+        free(home); free(enemies); free(bullets); free(candidates);
+        return false;
+    }
+
+    for (int j = 0; j < enemyCount; j++) {
+        home[j] = (Point){ FORMATION_SWAY + (j % cols + 0.5f) * ENEMY_SPACING, (j / cols + 0.5f) * ENEMY_SPACING };
+        enemies[j] = home[j];
+        MoveB2GridItem(&grid, j, (Vector2){ enemies[j].x, enemies[j].y });
+    }
+
+    // Frames suficientes para a força bruta somar ~20 milhões de testes
+    long long work = (long long)bulletCount * enemyCount;
+    int frames = (int)(20000000LL / work);
+    if (frames < 5) frames = 5;
+    if (frames > 2000) frames = 2000;
+
+    bool useGrid = (long long)bulletCount * enemyCount >= GRID_MIN_PAIRS;
+    double bruteTime = 0.0, gridTime = 0.0, gameTime = 0.0;
+    long long hits = 0, mismatches = 0;
+    for (int f = 0; f < frames; f++) {
+        // A formação anda de lado (vai e volta) e os tiros mudam de lugar
+        float offset = FORMATION_SWAY * (float)((f % 40) < 20 ? (f % 20) : 20 - (f % 20)) / 20.0f - FORMATION_SWAY * 0.5f;
+        for (int j = 0; j < enemyCount; j++) enemies[j].x = home[j].x + offset;
+        for (int b = 0; b < bulletCount; b++) bullets[b] = (Point){ RandomRange(0.0f, width), RandomRange(0.0f, height) };
+
+        double start = Seconds();
+        int bruteSum = 0;
+        for (int b = 0; b < bulletCount; b++) bruteSum += BruteFirstHit(enemies, enemyCount, bullets[b]);
+        bruteTime += Seconds() - start;
+
+        start = Seconds();
+        for (int j = 0; j < enemyCount; j++) MoveB2GridItem(&grid, j, (Vector2){ enemies[j].x, enemies[j].y });
+        int gridSum = 0;
+        for (int b = 0; b < bulletCount; b++) gridSum += GridFirstHit(&grid, enemies, bullets[b], candidates, enemyCount);
+        gridTime += Seconds() - start;
+
+        start = Seconds();
+        int gameSum = 0;
+        if (useGrid) {
+            for (int j = 0; j < enemyCount; j++) MoveB2GridItem(&grid, j, (Vector2){ enemies[j].x, enemies[j].y });
+            for (int b = 0; b < bulletCount; b++) gameSum += GridFirstHit(&grid, enemies, bullets[b], candidates, enemyCount);
+        } else {
+            for (int b = 0; b < bulletCount; b++) gameSum += BruteFirstHit(enemies, enemyCount, bullets[b]);
+        }
+        gameTime += Seconds() - start;
+
+        // Conferência fora da medição
+        if (bruteSum != gridSum || bruteSum != gameSum) {
+            for (int b = 0; b < bulletCount; b++) {
+                if (BruteFirstHit(enemies, enemyCount, bullets[b]) != GridFirstHit(&grid, enemies, bullets[b], candidates, enemyCount)) mismatches++;
+            }
+        }
+        for (int b = 0; b < bulletCount; b++) hits += (BruteFirstHit(enemies, enemyCount, bullets[b]) >= 0);
+    }
+
+    double bruteUs = bruteTime * 1e6 / frames;
+    double gridUs = gridTime * 1e6 / frames;
+    double gameUs = gameTime * 1e6 / frames;
+    printf("%6d %8d %12.1f %12.1f %8.1fx %12.1f %8.1fx %7.1f%%%s\n", bulletCount, enemyCount, bruteUs, gridUs,
+           gridUs > 0.0 ? bruteUs / gridUs : 0.0, gameUs, gameUs > 0.0 ? bruteUs / gameUs : 0.0,
+           100.0 * hits / ((double)frames * bulletCount),
+           mismatches ? "  DIVERGENTE" : "");
+
+    UnloadB2Grid(&grid);
+    free(home); free(enemies); free(bullets); free(candidates);
+    return mismatches == 0;
+}
+
+int main(int argc, char **argv) {
+    srand((argc > 1) ? (unsigned)atoi(argv[1]) : 1u);
+
+    printf("  tiros inimigos  bruta us/fr   grid us/fr    ganho   jogo us/fr    ganho  acertos\n");
+    bool ok = true;
+    for (size_t e = 0; e < sizeof(enemyCounts) / sizeof(enemyCounts[0]); e++) {
+        for (size_t b = 0; b < sizeof(bulletCounts) / sizeof(bulletCounts[0]); b++) {
+            if (!RunCase(bulletCounts[b], enemyCounts[e])) ok = false;
+        }
+    }
+    if (!ok) printf("FALHA: o grid escolheu um inimigo diferente da forca bruta.\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,276 @@
+// b2_headless: roda a simulação do Byte Space (b2_sim) sem janela nem áudio
+//
+// Uso:
+//   b2_headless <replay.b2r>                         toca um replay gravado pelo jogo
+//   b2_headless --bot [segundos] [semente] [saida]   um bot joga sozinho
+// Exemplos:
+//   b2_headless byte2_last.b2r
+//   b2_headless --bot 600 7 bot.b2r
+//
+// Replay: semeia o b2_rng com a semente gravada, passa os botões de cada tick e confere o
+// hash do estado final com o gravado (retorna 1 se divergir). Bot: pula a intro, sobe até
+// o portal da loja comprando o que alcança, segue o inimigo mais baixo atirando (rajadas
+// e tiros carregados) e passa pela loja uma onda sim, outra não, até perder, vencer ou
+// acabar o tempo; com [saida] grava o replay da partida, que tocado de novo por aqui tem
+// que bater (teste de regressão do determinismo).
+// Nos dois modos imprime ticks por segundo e o custo de cada sistema do tick.
+// A raylib entra só para as funções de CPU (colisão, FileExists, TextFormat): nada chama
+// InitWindow nem InitAudioDevice, então o asset_cache devolve texturas e sons vazios.
+
+#include "b2_sim.h"
+#include "b2_replay.h"
+#include "b2_rng.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOGDI
+#define NOUSER
+#include <windows.h>
+static double Seconds(void) {
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+}
+#else
+#include <time.h>
+static double Seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+#endif
+
+static const char *systemNames[B2_SYSTEM_COUNT] = {
+    "cenas", "jogador", "tiros", "inimigos", "particulas", "colisao"
+};
+
+static B2Sim sim;
+
+// --- BOT ---
+// Gerador próprio: o bot não pode consumir o b2_rng, senão a partida gravada não se repete
+typedef struct {
+    unsigned int rng;
+    float aimOffset;        // Desvio horizontal da mira
+    float moveTimer;        // Até sortear outro desvio
+    float fireTimer;        // Até soltar/apertar o tiro
+    bool firing;
+    int shopVisits;
+    uint64_t tick;
+} Bot;
+
+static float BotRandom(Bot *bot, float minValue, float maxValue) {
+    bot->rng = bot->rng * 1664525u + 1013904223u;
+    return minValue + (float)(bot->rng >> 8) / 16777216.0f * (maxValue - minValue);
+}
+
+// Botões de um toque: alternando os ticks, cada tick "segurado" é um novo aperto
+static uint16_t Tap(const Bot *bot, uint16_t button) {
+    return (bot->tick & 1u) ? button : 0;
+}
+
+static uint16_t BotButtons(Bot *bot, const B2Sim *s) {
+    const Player *player = &s->player;
+    const EnemyManager *enemies = &s->enemyManager;
+    uint16_t buttons = 0;
+    bot->tick++;
+
+    switch (s->state) {
+        case STATE_CUTSCENE:
+            return Tap(bot, B2_BUTTON_CONFIRM);
+
+        case STATE_ENDING:
+            // Enter sai da partida (não precisa passar os quadrinhos)
+            return Tap(bot, B2_BUTTON_CONFIRM);
+
+        case STATE_SHOP: {
+            // Compra o que estiver ao alcance no caminho e sobe até o portal
+            float targetX = s->shop.exitArea.x + s->shop.exitArea.width / 2 - player->size.x / 2;
+            if (player->position.x < targetX - 2.0f) buttons |= B2_BUTTON_RIGHT;
+            else if (player->position.x > targetX + 2.0f) buttons |= B2_BUTTON_LEFT;
+            buttons |= B2_BUTTON_UP;
+            return buttons | Tap(bot, B2_BUTTON_BUY | B2_BUTTON_PORTAL);
+        }
+
+        case STATE_GAMEPLAY:
+            if (enemies->gameOver) return Tap(bot, B2_BUTTON_CONFIRM);
+            if (enemies->triggerShopReturn) {
+                bool visit = (enemies->currentWave % 2) == 0;
+                buttons = Tap(bot, visit ? B2_BUTTON_BUY : B2_BUTTON_SKIP);
+                if (visit && buttons) bot->shopVisits++;
+                return buttons;
+            }
+            break;
+
+        default:
+            return 0;
+    }
+
+    // Gameplay: mira no inimigo mais baixo (o próximo a chegar na linha de game over), com
+    // um desvio aleatório que muda de tempos em tempos para não ficar parado numa coluna
+    bot->moveTimer -= B2_TICK_DT;
+    if (bot->moveTimer <= 0.0f) {
+        bot->aimOffset = BotRandom(bot, -60.0f, 60.0f);
+        bot->moveTimer = BotRandom(bot, 0.3f, 1.5f);
+    }
+    float targetX = -1.0f, lowestY = -1.0f;
+    if (enemies->bossActive && enemies->boss.active) {
+        targetX = enemies->boss.position.x;
+    } else {
+        for (int k = 0; k < enemies->alive.count; k++) {
+            int id = enemies->alive.dense[k];
+            if (enemies->formation.y[id] > lowestY) {
+                lowestY = enemies->formation.y[id];
+                targetX = enemies->formation.x[id];
+            }
+        }
+    }
+    if (targetX >= 0.0f) {
+        float centerX = player->position.x + player->size.x / 2;
+        float delta = targetX + bot->aimOffset - centerX;
+        if (delta < -4.0f) buttons |= B2_BUTTON_LEFT;
+        else if (delta > 4.0f) buttons |= B2_BUTTON_RIGHT;
+    }
+
+    // Toques rápidos (tiro fraco) com um tiro carregado de vez em quando (segurar e soltar)
+    bot->fireTimer -= B2_TICK_DT;
+    if (bot->fireTimer <= 0.0f) {
+        bot->firing = !bot->firing;
+        if (!bot->firing) bot->fireTimer = BotRandom(bot, 0.01f, 0.03f);
+        else if (BotRandom(bot, 0.0f, 1.0f) < 0.15f) bot->fireTimer = BotRandom(bot, 0.5f, 1.2f); // Carregado
+        else bot->fireTimer = BotRandom(bot, 0.01f, 0.05f);
+    }
+    if (bot->firing) buttons |= B2_BUTTON_FIRE;
+    return buttons;
+}
+
+// --- RELATÓRIO ---
+static void PrintTimings(const B2SimTimings *timings, double wall) {
+    double ticks = (double)timings->ticks;
+    double gameSeconds = ticks * B2_TICK_DT;
+    printf("%llu ticks (%.1f s de jogo) em %.3f s: %.0f ticks/s, %.0fx o tempo real\n",
+           (unsigned long long)timings->ticks, gameSeconds, wall,
+           wall > 0.0 ? ticks / wall : 0.0, wall > 0.0 ? gameSeconds / wall : 0.0);
+
+    double total = 0.0;
+    for (int i = 0; i < B2_SYSTEM_COUNT; i++) total += timings->seconds[i];
+    printf("  sistema       total ms    us/tick      %%\n");
+    for (int i = 0; i < B2_SYSTEM_COUNT; i++) {
+        double s = timings->seconds[i];
+        printf("  %-12s %9.2f %10.3f %6.1f\n", systemNames[i], s * 1000.0,
+               ticks > 0.0 ? s * 1e6 / ticks : 0.0, total > 0.0 ? 100.0 * s / total : 0.0);
+    }
+}
+
+static const char *StateName(GameState state) {
+    switch (state) {
+        case STATE_CUTSCENE: return "intro";
+        case STATE_SHOP: return "loja";
+        case STATE_GAMEPLAY: return "gameplay";
+        case STATE_ENDING: return "final";
+        default: return "?";
+    }
+}
+
+static void PrintOutcome(const B2Sim *s) {
+    printf("Fim: %s, onda %d, %d vidas, %d de ouro%s\n", StateName(s->state), s->enemyManager.currentWave,
+           s->player.currentLives, s->player.gold, s->enemyManager.gameOver ? " (game over)" : "");
+    printf("Pools cheios: %d tiros e %d particulas descartados\n", s->bulletManager.bullets.ids.overflow,
+           s->enemyManager.particles.dropped);
+}
+
+// --- MODOS ---
+static int RunReplay(const char *path) {
+    B2Replay replay = { 0 };
+    if (!LoadB2Replay(&replay, path)) {
+        printf("Falha ao ler %s\n", path);
+        return 2;
+    }
+    if (replay.tickRate != B2_TICK_RATE) {
+        printf("Replay gravado a %u Hz; a simulacao roda a %d Hz.\n", (unsigned)replay.tickRate, B2_TICK_RATE);
+        UnloadB2Replay(&replay);
+        return 2;
+    }
+
+    SeedB2Rng(replay.seed);
+    InitB2Sim(&sim);
+    sim.clock = Seconds;
+
+    B2Input input = { 0 };
+    uint16_t buttons = 0;
+    double start = Seconds();
+    while (!sim.shouldExit && NextB2ReplayTick(&replay, &buttons)) {
+        input = MakeB2Input(input.held, buttons);
+        StepB2Sim(&sim, &input, B2_TICK_DT);
+    }
+    double wall = Seconds() - start;
+
+    uint64_t hash = HashB2Sim(&sim);
+    bool complete = (sim.timings.ticks == replay.tickCount);
+    bool match = complete && (hash == replay.finalHash);
+    PrintTimings(&sim.timings, wall);
+    PrintOutcome(&sim);
+    printf("Semente %u, hash %016llx (gravado %016llx): %s\n", (unsigned)replay.seed,
+           (unsigned long long)hash, (unsigned long long)replay.finalHash,
+           match ? "OK" : (complete ? "DIVERGENTE" : "DIVERGENTE (a partida acabou antes do replay)"));
+
+    UnloadB2Sim(&sim);
+    UnloadB2Replay(&replay);
+    return match ? 0 : 1;
+}
+
+static int RunBot(double seconds, uint32_t seed, const char *outPath) {
+    B2Replay replay = { 0 };
+    if (outPath) BeginB2Recording(&replay, seed, B2_TICK_RATE);
+
+    SeedB2Rng(seed);
+    InitB2Sim(&sim);
+    sim.clock = Seconds;
+
+    Bot bot = { .rng = seed * 2654435761u + 1u };
+    uint64_t maxTicks = (uint64_t)(seconds * B2_TICK_RATE);
+    B2Input input = { 0 };
+    double start = Seconds();
+    while (!sim.shouldExit && sim.timings.ticks < maxTicks) {
+        uint16_t buttons = BotButtons(&bot, &sim);
+        if (outPath) RecordB2Tick(&replay, buttons);
+        input = MakeB2Input(input.held, buttons);
+        StepB2Sim(&sim, &input, B2_TICK_DT);
+    }
+    double wall = Seconds() - start;
+
+    uint64_t hash = HashB2Sim(&sim);
+    PrintTimings(&sim.timings, wall);
+    PrintOutcome(&sim);
+    printf("Semente %u, %d visitas a loja, hash %016llx\n", (unsigned)seed, bot.shopVisits,
+           (unsigned long long)hash);
+
+    int result = 0;
+    if (outPath) {
+        replay.finalHash = hash;
+        if (replay.failed) {
+            printf("Gravacao do replay incompleta (sem memoria); %s nao foi gravado.\n", outPath);
+            result = 2;
+        } else if (SaveB2Replay(&replay, outPath)) {
+            printf("Replay gravado em %s\n", outPath);
+        } else {
+            result = 2;
+        }
+        UnloadB2Replay(&replay);
+    }
+    UnloadB2Sim(&sim);
+    return result;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1 && strcmp(argv[1], "--bot") == 0) {
+        double seconds = (argc > 2) ? atof(argv[2]) : 600.0;
+        if (seconds <= 0.0) seconds = 600.0;
+        uint32_t seed = (argc > 3) ? (uint32_t)strtoul(argv[3], NULL, 10) : 1u;
+        return RunBot(seconds, seed, (argc > 4) ? argv[4] : NULL);
+    }
+    return RunReplay((argc > 1) ? argv[1] : B2_REPLAY_FILE);
+}
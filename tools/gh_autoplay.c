@@ -0,0 +1,190 @@
+// gh_autoplay: roda um chart inteiro do Guitar Hero sem janela nem áudio
+//
+// Uso:
+//   gh_autoplay [arquivo.mid] [modo] [ms] [fps] [semente]
+// Modos:
+//   perfect  toca cada nota no instante exato
+//   early    toca cada nota [ms] antes (padrão 40)
+//   late     toca cada nota [ms] depois (padrão 40)
+//   random   desvio uniforme de até +-[ms] (padrão 60) e toques soltos de vez em quando
+// Exemplo:
+//   gh_autoplay assets/guitar_musics/notes.mid random 80 60 7
+//
+// Gera os toques (apertar/soltar, com sustains) a partir do chart, alimenta o gh_sim com
+// o mesmo passo a passo do guitar_hero.c (um passo por frame de [fps], toques julgados no
+// próprio instante) o mais rápido possível, e mostra frames/s da simulação, o custo do
+// pior frame, a distribuição dos julgamentos e o histograma de desvios. No modo perfect
+// o retorno é 1 se alguma nota não for acertada (serve de teste de regressão).
+
+#include "gh_chart.h"
+#include "gh_sim.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+static double Seconds(void) {
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+}
+#else
+#include <time.h>
+static double Seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+#endif
+
+typedef enum { MODE_PERFECT, MODE_EARLY, MODE_LATE, MODE_RANDOM } AutoplayMode;
+
+typedef struct {
+    float time;
+    int fret;
+    bool down;
+} InputEvent;
+
+static const char *judgeNames[GH_JUDGE_TYPE_COUNT] = { "acertos", "perdidas", "toques sem nota", "sustains soltos" };
+
+static GhSim sim;
+
+// --- ENTRADA SINTÉTICA ---
+static float NoteOffset(AutoplayMode mode, float ms) {
+    switch (mode) {
+        case MODE_EARLY: return -ms / 1000.0f;
+        case MODE_LATE: return ms / 1000.0f;
+        case MODE_RANDOM: return ((float)rand() / RAND_MAX * 2.0f - 1.0f) * ms / 1000.0f;
+        default: return 0.0f;
+    }
+}
+
+static int CompareEvents(const void *pa, const void *pb) {
+    const InputEvent *a = (const InputEvent *)pa;
+    const InputEvent *b = (const InputEvent *)pb;
+    if (a->time != b->time) return (a->time < b->time) ? -1 : 1;
+    return (int)a->down - (int)b->down; // Soltar antes de apertar no mesmo instante
+}
+
+// Um apertar e um soltar por nota; notas longas ficam seguradas até o fim
+static InputEvent *BuildInput(const GhChart *chart, AutoplayMode mode, float ms, int *outCount) {
+    int capacity = (int)chart->noteCount * 2 + 64;
+    InputEvent *events = (InputEvent *)malloc((size_t)capacity * sizeof(InputEvent));
+    if (!events) return NULL;
+    int count = 0;
+
+    for (int f = 0; f < GH_CHART_FRETS; f++) {
+        for (uint32_t k = chart->fretOffset[f]; k < chart->fretOffset[f + 1]; k++) {
+            const GhChartNote *n = &chart->notes[chart->laneIndex[k]];
+            float press = n->time + NoteOffset(mode, ms);
+            // Nota longa: segura até um pouco depois do fim, qualquer que seja o desvio
+            float release = (n->sustain >= 0.1f) ? n->time + n->sustain + 0.01f : press + 0.04f;
+
+            // Solta antes do toque mais cedo possível da próxima nota do mesmo fret
+            if (k + 1 < chart->fretOffset[f + 1]) {
+                float nextPress = chart->notes[chart->laneIndex[k + 1]].time - fabsf(ms) / 1000.0f;
+                if (release > nextPress - 0.005f) release = nextPress - 0.005f;
+            }
+            if (release <= press) release = press + 0.001f;
+
+            events[count++] = (InputEvent){ press, f, true };
+            events[count++] = (InputEvent){ release, f, false };
+        }
+    }
+
+    // Toques soltos (sem nota) no modo random
+    if (mode == MODE_RANDOM) {
+        for (int i = 0; i < 32 && count + 2 <= capacity; i++) {
+            float t = (float)rand() / RAND_MAX * chart->lastNoteTime;
+            int f = rand() % GH_CHART_FRETS;
+            events[count++] = (InputEvent){ t, f, true };
+            events[count++] = (InputEvent){ t + 0.03f, f, false };
+        }
+    }
+
+    qsort(events, (size_t)count, sizeof(InputEvent), CompareEvents);
+    *outCount = count;
+    return events;
+}
+
+int main(int argc, char **argv) {
+    const char *path = (argc > 1) ? argv[1] : "assets/guitar_musics/notes.mid";
+    const char *modeName = (argc > 2) ? argv[2] : "perfect";
+    AutoplayMode mode = MODE_PERFECT;
+    float ms = 0.0f;
+    if (strcmp(modeName, "early") == 0) { mode = MODE_EARLY; ms = 40.0f; }
+    else if (strcmp(modeName, "late") == 0) { mode = MODE_LATE; ms = 40.0f; }
+    else if (strcmp(modeName, "random") == 0) { mode = MODE_RANDOM; ms = 60.0f; }
+    else if (strcmp(modeName, "perfect") != 0) {
+        printf("Modo desconhecido '%s' (perfect, early, late, random)\n", modeName);
+        return 2;
+    }
+    if (argc > 3) ms = (float)atof(argv[3]);
+    int fps = (argc > 4) ? atoi(argv[4]) : 60;
+    if (fps < 1) fps = 60;
+    srand((argc > 5) ? (unsigned)atoi(argv[5]) : 1u);
+
+    GhChart chart;
+    if (!GhChart_Load(path, &chart)) {
+        printf("Falha ao ler %s\n", path);
+        return 2;
+    }
+
+    int inputCount = 0;
+    InputEvent *input = BuildInput(&chart, mode, ms, &inputCount);
+    if (!input) return 2;
+    GhSim_Load(&sim, &chart);
+    GhChart_Unload(&chart);
+
+    // --- SIMULAÇÃO ---
+    const float dt = 1.0f / (float)fps;
+    bool held[GH_SIM_FRETS] = { false };
+    int next = 0, frames = 0;
+    double worstFrame = 0.0;
+    double start = Seconds();
+
+    while (sim.state == GH_SIM_PLAYING) {
+        float songTime = frames * dt;
+        double frameStart = Seconds();
+
+        GhSim_BeginStep(&sim, songTime);
+        while (next < inputCount && input[next].time <= songTime) {
+            const InputEvent *e = &input[next++];
+            held[e->fret] = e->down;
+            if (e->down) GhSim_Press(&sim, e->fret, e->time);
+            else GhSim_Release(&sim, e->fret, e->time);
+        }
+        GhSim_EndStep(&sim, songTime, dt, held);
+
+        double frameCost = Seconds() - frameStart;
+        if (frameCost > worstFrame) worstFrame = frameCost;
+        frames++;
+    }
+    double elapsed = Seconds() - start;
+    free(input);
+
+    // --- RELATÓRIO ---
+    float songSeconds = frames * dt;
+    printf("%s: %d notas, modo %s (%.0f ms), %d fps\n", path, sim.noteCount, modeName, ms, fps);
+    printf("simulacao: %d frames (%.1f s de musica) em %.2f ms -> %.0f frames/s, %.0fx tempo real\n",
+           frames, songSeconds, elapsed * 1000.0, elapsed > 0.0 ? frames / elapsed : 0.0,
+           elapsed > 0.0 ? songSeconds / elapsed : 0.0);
+    printf("custo por frame: medio %.2f us, pior %.2f us\n", elapsed * 1e6 / (frames ? frames : 1), worstFrame * 1e6);
+    for (int t = 0; t < GH_JUDGE_TYPE_COUNT; t++) printf("  %-16s %6d\n", judgeNames[t], sim.judgeTotals[t]);
+    printf("resultado: %s, score %d, vida %.0f\n",
+           sim.state == GH_SIM_WIN ? "VITORIA" : "DERROTA", (int)sim.score, sim.health);
+    GhSim_PrintHistogram(&sim);
+
+    if (mode == MODE_PERFECT) {
+        bool ok = sim.state == GH_SIM_WIN && sim.judgeTotals[GH_JUDGE_HIT] == sim.noteCount &&
+                  sim.judgeTotals[GH_JUDGE_MISS] == 0 && sim.judgeTotals[GH_JUDGE_OVERSTRUM] == 0 &&
+                  sim.judgeTotals[GH_JUDGE_DROP] == 0;
+        if (!ok) printf("FALHA: o modo perfect deveria acertar todas as notas.\n");
+        return ok ? 0 : 1;
+    }
+    return 0;
+}
@@ -0,0 +1,189 @@
+// midi_bench: compara o parser MIDI antigo (fgetc/fseek por byte) com o gh_midi
+//
+// Uso:
+//   midi_bench [arquivo.mid] [iteracoes]
+// Exemplo:
+//   midi_bench assets/guitar_musics/notes.mid 200
+//
+// Mede o tempo médio de cada parser (leitura + ordenação) e confere que os dois
+// produzem os mesmos eventos. Não depende da raylib.
+
+#include "gh_midi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// --- PARSER ANTIGO (cópia do guitar_hero.c antes do gh_midi) ---
+#define LEGACY_MAX_EVENTS 60000
+
+static MidiEvent legacyEvents[LEGACY_MAX_EVENTS];
+static int legacyEventCount = 0;
+
+static uint32_t read_be32(FILE *f) {
+    int a = fgetc(f); int b = fgetc(f); int c = fgetc(f); int d = fgetc(f);
+    return ((uint32_t)a << 24) | ((uint32_t)b << 16) | ((uint32_t)c << 8) | (uint32_t)d;
+}
+static uint16_t read_be16(FILE *f) {
+    int a = fgetc(f); int b = fgetc(f);
+    return (uint16_t)(((uint16_t)a << 8) | (uint16_t)b);
+}
+static uint32_t read_varlen(FILE *f) {
+    uint32_t v = 0; int c;
+    while ((c = fgetc(f)) != EOF) {
+        v = (v << 7) | (c & 0x7F);
+        if (!(c & 0x80)) break;
+    }
+    return v;
+}
+static int cmp_raw_event(const void *pa, const void *pb) {
+    const MidiEvent *a = (const MidiEvent*)pa;
+    const MidiEvent *b = (const MidiEvent*)pb;
+    if (a->tick < b->tick) return -1;
+    if (a->tick > b->tick) return 1;
+    return 1;
+}
+static int LegacyParseMidiFile(const char *path, uint16_t *out_ticksPerQN) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return 0;
+    fseek(f, 4 + 4, SEEK_SET);
+    read_be16(f);
+    uint16_t ntrks = read_be16(f);
+    *out_ticksPerQN = read_be16(f);
+    legacyEventCount = 0;
+
+    for (int t = 0; t < ntrks; t++) {
+        char tag[4];
+        if (fread(tag, 1, 4, f) != 4) break;
+        if (strncmp(tag, "MTrk", 4) != 0) break;
+        uint32_t len = read_be32(f);
+        long end = ftell(f) + len;
+        int tempStart = legacyEventCount;
+        int isGuitar = 0;
+        uint32_t absTick = 0;
+        unsigned char rs = 0;
+
+        while (ftell(f) < end) {
+            uint32_t delta = read_varlen(f);
+            absTick += delta;
+            unsigned char st = 0;
+            int c = fgetc(f);
+            if (c & 0x80) {
+                st = c; rs = st;
+            } else {
+                st = rs; ungetc(c, f);
+            }
+            if (st == 0xFF) {
+                int type = fgetc(f);
+                uint32_t l = read_varlen(f);
+                long dp = ftell(f);
+                if (type == 0x03) {
+                    char n[256] = {0};
+                    if (l < 255 && fread(n, 1, l, f) != l) n[0] = 0;
+                    if (strstr(n, "PART GUITAR")) isGuitar = 1;
+                } else if (type == 0x51 && l == 3) {
+                    int b1 = fgetc(f); int b2 = fgetc(f); int b3 = fgetc(f);
+                    if (legacyEventCount < LEGACY_MAX_EVENTS) {
+                        legacyEvents[legacyEventCount] = (MidiEvent){absTick, 0, 0, (uint32_t)((b1 << 16) | (b2 << 8) | b3)};
+                        legacyEventCount++;
+                    }
+                }
+                fseek(f, dp + l, SEEK_SET);
+            } else if (st == 0xF0 || st == 0xF7) {
+                uint32_t l = read_varlen(f);
+                fseek(f, l, SEEK_CUR);
+            } else {
+                int type = st & 0xF0;
+                if (type == 0x90 || type == 0x80) {
+                    int n = fgetc(f);
+                    int v = fgetc(f);
+                    if (n >= 84 && n <= 88 && legacyEventCount < LEGACY_MAX_EVENTS) {
+                        legacyEvents[legacyEventCount] = (MidiEvent){absTick, (type == 0x90 && v > 0) ? 1 : 2, n, 0};
+                        legacyEventCount++;
+                    }
+                } else {
+                    fgetc(f);
+                    if ((type & 0xF0) != 0xC0 && (type & 0xF0) != 0xD0) fgetc(f);
+                }
+            }
+        }
+
+        if (!isGuitar) {
+            int wIdx = tempStart;
+            for (int i = tempStart; i < legacyEventCount; i++) {
+                if (legacyEvents[i].type == 0) {
+                    legacyEvents[wIdx++] = legacyEvents[i];
+                }
+            }
+            legacyEventCount = wIdx;
+        }
+        fseek(f, end, SEEK_SET);
+    }
+
+    fclose(f);
+    qsort(legacyEvents, legacyEventCount, sizeof(MidiEvent), cmp_raw_event);
+    return 1;
+}
+
+// --- COMPARAÇÃO ---
+// O qsort antigo não é estável: eventos no mesmo tick podem sair em qualquer ordem,
+// então a conferência compara as duas listas numa ordem canônica
+static int CompareCanonical(const void *pa, const void *pb) {
+    const MidiEvent *a = (const MidiEvent *)pa;
+    const MidiEvent *b = (const MidiEvent *)pb;
+    if (a->tick != b->tick) return (a->tick < b->tick) ? -1 : 1;
+    if (a->type != b->type) return a->type - b->type;
+    if (a->note != b->note) return a->note - b->note;
+    if (a->tempo != b->tempo) return (a->tempo < b->tempo) ? -1 : 1;
+    return 0;
+}
+
+static double Seconds(void) {
+    return (double)clock() / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char **argv) {
+    const char *path = (argc > 1) ? argv[1] : "assets/guitar_musics/notes.mid";
+    int iterations = (argc > 2) ? atoi(argv[2]) : 200;
+    if (iterations < 1) iterations = 1;
+
+    uint16_t legacyTicks = 0;
+    MidiEventList list = {0};
+    if (!LegacyParseMidiFile(path, &legacyTicks) || !GhMidi_Load(path, &list)) {
+        printf("Falha ao ler %s\n", path);
+        return 1;
+    }
+
+    // Conferência
+    int mismatches = (legacyEventCount != list.count || legacyTicks != list.ticksPerQN);
+    if (!mismatches) {
+        MidiEvent *a = (MidiEvent *)malloc((size_t)list.count * sizeof(MidiEvent));
+        MidiEvent *b = (MidiEvent *)malloc((size_t)list.count * sizeof(MidiEvent));
+        memcpy(a, legacyEvents, (size_t)list.count * sizeof(MidiEvent));
+        memcpy(b, list.events, (size_t)list.count * sizeof(MidiEvent));
+        qsort(a, list.count, sizeof(MidiEvent), CompareCanonical);
+        qsort(b, list.count, sizeof(MidiEvent), CompareCanonical);
+        for (int i = 0; i < list.count; i++) {
+            if (CompareCanonical(&a[i], &b[i]) != 0) mismatches++;
+        }
+        free(a);
+        free(b);
+    }
+    printf("%s: %d eventos, %u ticks/seminima, %s\n", path, list.count, list.ticksPerQN,
+           mismatches ? "DIVERGENTE do parser antigo" : "igual ao parser antigo");
+
+    // Tempo
+    double start = Seconds();
+    for (int i = 0; i < iterations; i++) LegacyParseMidiFile(path, &legacyTicks);
+    double legacyMs = (Seconds() - start) * 1000.0 / iterations;
+
+    start = Seconds();
+    for (int i = 0; i < iterations; i++) GhMidi_Load(path, &list);
+    double newMs = (Seconds() - start) * 1000.0 / iterations;
+
+    printf("fgetc/fseek: %.3f ms   gh_midi: %.3f ms   (%.1fx, %d iteracoes)\n",
+           legacyMs, newMs, newMs > 0.0 ? legacyMs / newMs : 0.0, iterations);
+
+    GhMidi_Free(&list);
+    return mismatches ? 1 : 0;
+}
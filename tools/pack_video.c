@@ -0,0 +1,135 @@
+// pack_video: empacota uma sequência de frames JPEG em um único arquivo .vpk
+//
+// Uso:
+//   pack_video <formato_dos_frames> <quantidade> <fps> <saida.vpk>
+// Exemplo:
+//   pack_video assets/frames/intro/frame_%04d.jpg 793 60 assets/frames/intro.vpk
+//
+// O formato está descrito em include/video_pack.h. Os JPEGs são copiados sem
+// recompressão; o jogo lê o pack via mmap e decodifica direto do mapeamento.
+
+#include "video_pack.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static unsigned char *ReadWholeFile(const char *path, long *size) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    unsigned char *data = (unsigned char *)malloc(*size > 0 ? (size_t)*size : 1);
+    if (data && fread(data, 1, (size_t)*size, f) != (size_t)*size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    return data;
+}
+
+// Lê largura/altura do marcador SOF (baseline ou progressive) do JPEG
+static int ReadJpegSize(const unsigned char *data, long size, uint32_t *width, uint32_t *height) {
+    long pos = 2;
+    if (size < 4 || data[0] != 0xFF || data[1] != 0xD8) return 0;
+
+    while (pos + 4 <= size) {
+        if (data[pos] != 0xFF) return 0;
+        unsigned char marker = data[pos + 1];
+        long length = ((long)data[pos + 2] << 8) | data[pos + 3];
+
+        if ((marker == 0xC0 || marker == 0xC1 || marker == 0xC2) && pos + 9 <= size) {
+            *height = ((uint32_t)data[pos + 5] << 8) | data[pos + 6];
+            *width = ((uint32_t)data[pos + 7] << 8) | data[pos + 8];
+            return 1;
+        }
+        pos += 2 + length;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 5) {
+        printf("Uso: %s <formato_dos_frames> <quantidade> <fps> <saida.vpk>\n", argv[0]);
+        return 1;
+    }
+
+    const char *format = argv[1];
+    int frameCount = atoi(argv[2]);
+    float fps = (float)atof(argv[3]);
+    const char *outPath = argv[4];
+
+    if (frameCount <= 0 || fps <= 0.0f) {
+        printf("ERRO: quantidade e fps devem ser positivos.\n");
+        return 1;
+    }
+
+    FILE *out = fopen(outPath, "wb");
+    if (!out) {
+        printf("ERRO: nao foi possivel criar %s\n", outPath);
+        return 1;
+    }
+
+    VideoPackHeader header = {0};
+    memcpy(header.magic, VIDEO_PACK_MAGIC, 4);
+    header.version = VIDEO_PACK_VERSION;
+    header.frameCount = (uint32_t)frameCount;
+    header.fps = fps;
+    header.codec = VIDEO_CODEC_JPEG;
+
+    VideoPackEntry *index = (VideoPackEntry *)calloc((size_t)frameCount, sizeof(VideoPackEntry));
+    uint64_t offset = sizeof(VideoPackHeader) + (uint64_t)frameCount * sizeof(VideoPackEntry);
+
+    // Reserva o espaço do header e do índice; são escritos no final
+    fwrite(&header, sizeof(header), 1, out);
+    fwrite(index, sizeof(VideoPackEntry), (size_t)frameCount, out);
+
+    char path[512];
+    for (int i = 0; i < frameCount; i++) {
+        snprintf(path, sizeof(path), format, i + 1);
+
+        long size = 0;
+        unsigned char *data = ReadWholeFile(path, &size);
+        if (!data) {
+            printf("ERRO: nao foi possivel ler %s\n", path);
+            fclose(out);
+            remove(outPath); // Sem pack pela metade: o jogo usaria um .vpk quebrado
+            free(index);
+            return 1;
+        }
+
+        uint32_t w = 0, h = 0;
+        if (!ReadJpegSize(data, size, &w, &h)) {
+            printf("ERRO: %s nao e um JPEG valido\n", path);
+            free(data);
+            fclose(out);
+            remove(outPath);
+            free(index);
+            return 1;
+        }
+        if (i == 0) {
+            header.width = w;
+            header.height = h;
+        } else if (w != header.width || h != header.height) {
+            printf("AVISO: %s tem %ux%u (esperado %ux%u)\n", path, w, h, header.width, header.height);
+        }
+
+        index[i].offset = offset;
+        index[i].size = (uint32_t)size;
+        fwrite(data, 1, (size_t)size, out);
+        offset += (uint64_t)size;
+        free(data);
+    }
+
+    fseek(out, 0, SEEK_SET);
+    fwrite(&header, sizeof(header), 1, out);
+    fwrite(index, sizeof(VideoPackEntry), (size_t)frameCount, out);
+    fclose(out);
+    free(index);
+
+    printf("%s: %d frames %ux%u @ %.2f fps, %.1f MB\n", outPath, frameCount,
+           header.width, header.height, fps, (double)offset / (1024.0 * 1024.0));
+    return 0;
+}
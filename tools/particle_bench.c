@@ -0,0 +1,175 @@
+// particle_bench: compara a atualização de partículas antiga (array de structs com flag
+// de ativa, um laço com desvios) com o ParticleSystem (estrutura de arrays, compacto)
+//
+// Uso:
+//   particle_bench [particulas] [frames]
+// Exemplo:
+//   particle_bench 65536 600
+//
+// Os dois mantêm [particulas] vivas (as que morrem são emitidas de novo no mesmo frame),
+// com a configuração das explosões do Byte Space: arrasto e quique nas bordas. Mede o
+// tempo médio por frame e por partícula de cada um. Só o update entra na medição; nada é
+// desenhado (a raylib entra só para o link do particles.c).
+
+#include "particles.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOGDI
+#define NOUSER
+#include <windows.h>
+static double Seconds(void) {
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+}
+#else
+#include <time.h>
+static double Seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+#endif
+
+#define BENCH_WIDTH 800.0f
+#define BENCH_HEIGHT 600.0f
+#define BENCH_DRAG 0.8f
+#define BENCH_DT (1.0f / 60.0f)
+
+// Gerador próprio (o rand() do MinGW só tem 15 bits e é lento no laço de emissão)
+static unsigned int rngState = 1u;
+static float RandomFloat(float minValue, float maxValue) {
+    rngState = rngState * 1664525u + 1013904223u;
+    return minValue + (float)(rngState >> 8) / 16777216.0f * (maxValue - minValue);
+}
+
+static void RandomParticle(Vector2 *position, Vector2 *velocity, float *life) {
+    float speed = RandomFloat(150.0f, 400.0f);
+    float angle = RandomFloat(0.0f, 6.2831853f);
+    *position = (Vector2){ RandomFloat(0.0f, BENCH_WIDTH), RandomFloat(0.0f, BENCH_HEIGHT) };
+    *velocity = (Vector2){ cosf(angle) * speed, sinf(angle) * speed };
+    *life = RandomFloat(0.2f, 1.5f);
+}
+
+// --- VERSÃO ANTIGA (cópia do UpdateParticles do b2_enemy.c) ---
+typedef struct {
+    Vector2 position;
+    Vector2 velocity;
+    Color color;
+    float life;
+    bool active;
+} LegacyParticle;
+
+static void LegacyUpdate(LegacyParticle *particles, int capacity, float deltaTime) {
+    for (int i = 0; i < capacity; i++) {
+        LegacyParticle *p = &particles[i];
+        if (!p->active) continue;
+
+        p->life -= deltaTime;
+
+        if (p->life <= 0.0f) {
+            p->active = false;
+        } else {
+            p->position.x += p->velocity.x * deltaTime;
+            p->position.y += p->velocity.y * deltaTime;
+
+            if (p->position.x < 0 || p->position.x > BENCH_WIDTH) {
+                p->velocity.x *= -1;
+                p->position.x = fmaxf(0, fminf(p->position.x, BENCH_WIDTH));
+            }
+            if (p->position.y < 0 || p->position.y > BENCH_HEIGHT) {
+                p->velocity.y *= -1;
+                p->position.y = fmaxf(0, fminf(p->position.y, BENCH_HEIGHT));
+            }
+
+            float damping = 1.0f - (BENCH_DRAG * deltaTime);
+            p->velocity.x *= damping;
+            p->velocity.y *= damping;
+        }
+    }
+}
+
+// Reemite nos slots que morreram (a busca por slot livre fazia parte do custo antigo)
+static void LegacyRefill(LegacyParticle *particles, int capacity) {
+    for (int i = 0; i < capacity; i++) {
+        if (particles[i].active) continue;
+        LegacyParticle *p = &particles[i];
+        RandomParticle(&p->position, &p->velocity, &p->life);
+        p->color = WHITE;
+        p->active = true;
+    }
+}
+
+static double RunLegacy(int count, int frames) {
+    LegacyParticle *particles = (LegacyParticle *)calloc((size_t)count, sizeof(LegacyParticle));
+    if (!particles) return -1.0;
+    LegacyRefill(particles, count);
+
+    double updateTime = 0.0;
+    for (int f = 0; f < frames; f++) {
+        double start = Seconds();
+        LegacyUpdate(particles, count, BENCH_DT);
+        updateTime += Seconds() - start;
+        LegacyRefill(particles, count);
+    }
+    free(particles);
+    return updateTime;
+}
+
+// --- PARTICLESYSTEM ---
+static void SystemRefill(ParticleSystem *system) {
+    while (system->count < system->capacity) {
+        Vector2 position, velocity;
+        float life;
+        RandomParticle(&position, &velocity, &life);
+        ParticleSystem_Emit(system, position, velocity, WHITE, life);
+    }
+}
+
+static double RunSystem(int count, int frames) {
+    ParticleConfig config = {
+        .gravity = 0.0f, .drag = BENCH_DRAG, .bounded = true, .bounds = { 0.0f, 0.0f, BENCH_WIDTH, BENCH_HEIGHT },
+        .fadeSeconds = 1.0f, .shape = PARTICLE_SHAPE_CIRCLE, .size = 3.0f
+    };
+    ParticleSystem system;
+    if (!ParticleSystem_Init(&system, count, config)) return -1.0;
+    SystemRefill(&system);
+
+    double updateTime = 0.0;
+    for (int f = 0; f < frames; f++) {
+        double start = Seconds();
+        ParticleSystem_Update(&system, BENCH_DT);
+        updateTime += Seconds() - start;
+        SystemRefill(&system);
+    }
+    ParticleSystem_Unload(&system);
+    return updateTime;
+}
+
+int main(int argc, char **argv) {
+    int count = (argc > 1) ? atoi(argv[1]) : 65536;
+    int frames = (argc > 2) ? atoi(argv[2]) : 600;
+    if (count < 1) count = 65536;
+    if (frames < 1) frames = 600;
+
+    rngState = 1u;
+    double legacy = RunLegacy(count, frames);
+    rngState = 1u;
+    double soa = RunSystem(count, frames);
+    if (legacy < 0.0 || soa < 0.0) {
+        printf("Sem memoria para %d particulas.\n", count);
+        return 2;
+    }
+
+    double perParticle = 1e9 / ((double)count * frames);
+    printf("%d particulas vivas, %d frames\n", count, frames);
+    printf("  antigo (AoS + flag): %8.3f ms/frame, %6.2f ns/particula\n", legacy * 1000.0 / frames, legacy * perParticle);
+    printf("  ParticleSystem:      %8.3f ms/frame, %6.2f ns/particula\n", soa * 1000.0 / frames, soa * perParticle);
+    printf("  ganho: %.2fx\n", soa > 0.0 ? legacy / soa : 0.0);
+    return 0;
+}